@@ -2,6 +2,8 @@
 // Created by Dhruva Sharma on 18/2/25.
 //
 #include "headers/Image.h"
+#include "headers/thread_pool.h"
+#include "headers/pixel_kernels.h"
 #define STB_IMAGE_IMPLEMENTATION
 #include "stb_image.h"
 #define STB_IMAGE_WRITE_IMPLEMENTATION
@@ -32,43 +34,37 @@ bool Image::load(const std::string& filename) {
   }
 
   pixels_.resize(width_ * height_);
-  for(int i = 0; i < height_; i++) {
-    for(int j = 0; j < width_; j++) {
-      int index = (i * width_ + j)*4;
-      pixels_[i * width_ + j] = Color(
-            static_cast<float>(data[index + 0]) / 255.0f,  // R
-            static_cast<float>(data[index + 1]) / 255.0f,  // G
-            static_cast<float>(data[index + 2]) / 255.0f,  // B
-            static_cast<float>(data[index + 3]) / 255.0f);  // A
-    }
-  }
+  thread_pool::parallelFor(0, height_, 0, [&](int first, int last) {
+    size_t offset = static_cast<size_t>(first) * width_;
+    pixel_kernels::rgba8ToColors(data + offset * 4, pixels_.data() + offset, (last - first) * width_);
+  });
   stbi_image_free(data);
   return true;
 }
 
 bool Image::save(const std::string& filename, const std::string& format){
   unsigned char* data = new unsigned char[width_ * height_ * 4];
-  for(int i = 0; i < height_; i++) {
-    for(int j = 0; j < width_; j++) {
-      Color color = getPixel(j,i).Clamped();
-      int index = (i * width_ + j) * 4;
-      data[index + 0] = static_cast<float>(color.r * 255.0f);
-      data[index + 1] = static_cast<float>(color.g * 255.0f);
-      data[index + 2] = static_cast<float>(color.b * 255.0f);
-      data[index + 3] = static_cast<float>(color.a * 255.0f);
-    }
-  }
+  thread_pool::parallelFor(0, height_, 0, [&](int first, int last) {
+    size_t offset = static_cast<size_t>(first) * width_;
+    pixel_kernels::colorsToRgba8(pixels_.data() + offset, data + offset * 4, (last - first) * width_);
+  });
+  bool success = saveRgba8(filename, format, data, width_, height_);
+  delete[] data;
+  return success;
+}
+
+bool Image::saveRgba8(const std::string& filename, const std::string& format, const unsigned char* data,
+                      int width, int height) {
   bool success = false;
   if (format == "png" || format == "PNG") {
-    success = stbi_write_png(filename.c_str(), width_, height_, 4, data, width_ * 4);
+    success = stbi_write_png(filename.c_str(), width, height, 4, data, width * 4);
   } else if (format == "bmp" || format == "BMP") {
-    success = stbi_write_bmp(filename.c_str(), width_, height_, 4, data);
+    success = stbi_write_bmp(filename.c_str(), width, height, 4, data);
   } else if (format == "jpg" || format == "JPG" || format == "jpeg" || format == "JPEG") {
-    success = stbi_write_jpg(filename.c_str(), width_, height_, 4, data, 95);
+    success = stbi_write_jpg(filename.c_str(), width, height, 4, data, 95);
   } else {
     std::cerr << "Unsupported image format: " << format << std::endl;
   }
-  delete[] data;
   if (!success) {
     std::cerr << "Failed to save image: " << filename << std::endl;
   } return success;
@@ -88,5 +84,13 @@ void Image::setPixel(int x, int y, const Color& color){
   }
 }
 
+const Color* Image::getRow(int y) const {
+  return pixels_.data() + y * width_;
+}
+
+Color* Image::getRow(int y) {
+  return pixels_.data() + y * width_;
+}
+
 int Image::getWidth() const { return width_; }
 int Image::getHeight() const { return height_; }
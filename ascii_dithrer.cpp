@@ -1,5 +1,11 @@
 #include "headers/ascii_dithrer.h"
 #include "headers/Image.h"
+#include "headers/filter_kernels.h"
+#include "headers/gaussian_blur.h"
+#include "headers/glyph_blit.h"
+#include "headers/glyph_ramps.h"
+#include "headers/pixel_kernels.h"
+#include "headers/thread_pool.h"
 #include <fstream>
 #include <cmath>
 #include <algorithm>
@@ -7,223 +13,77 @@
 
 // Edge direction characters
 static const char edge_chars[4] = {'|', '-', '/', '\\'};
-// Luminance ramp for fill
-static const char* luminance_chars = " .:-=+*#%@";
-
-// Helper clamp function
-static int clampi(int v, int lo, int hi) { return v < lo ? lo : (v > hi ? hi : v); }
-
-// Font8x8 data - Basic Latin characters (U+0020 to U+007F)
-const unsigned char AsciiDithrer::font8x8_basic[128][8] = {
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},   // U+0000 (nul)
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},   // U+0001
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},   // U+0002
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},   // U+0003
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},   // U+0004
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},   // U+0005
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},   // U+0006
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},   // U+0007
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},   // U+0008
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},   // U+0009
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},   // U+000A
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},   // U+000B
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},   // U+000C
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},   // U+000D
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},   // U+000E
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},   // U+000F
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},   // U+0010
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},   // U+0011
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},   // U+0012
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},   // U+0013
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},   // U+0014
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},   // U+0015
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},   // U+0016
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},   // U+0017
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},   // U+0018
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},   // U+0019
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},   // U+001A
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},   // U+001B
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},   // U+001C
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},   // U+001D
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},   // U+001E
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},   // U+001F
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},   // U+0020 (space)
-    { 0x18, 0x3C, 0x3C, 0x18, 0x18, 0x00, 0x18, 0x00},   // U+0021 (!)
-    { 0x36, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},   // U+0022 (")
-    { 0x36, 0x36, 0x7F, 0x36, 0x7F, 0x36, 0x36, 0x00},   // U+0023 (#)
-    { 0x0C, 0x3E, 0x03, 0x1E, 0x30, 0x1F, 0x0C, 0x00},   // U+0024 ($)
-    { 0x00, 0x63, 0x33, 0x18, 0x0C, 0x66, 0x63, 0x00},   // U+0025 (%)
-    { 0x1C, 0x36, 0x1C, 0x6E, 0x3B, 0x33, 0x6E, 0x00},   // U+0026 (&)
-    { 0x06, 0x06, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00},   // U+0027 (')
-    { 0x18, 0x0C, 0x06, 0x06, 0x06, 0x0C, 0x18, 0x00},   // U+0028 (()
-    { 0x06, 0x0C, 0x18, 0x18, 0x18, 0x0C, 0x06, 0x00},   // U+0029 ())
-    { 0x00, 0x66, 0x3C, 0xFF, 0x3C, 0x66, 0x00, 0x00},   // U+002A (*)
-    { 0x00, 0x0C, 0x0C, 0x3F, 0x0C, 0x0C, 0x00, 0x00},   // U+002B (+)
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x06},   // U+002C (,)
-    { 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00},   // U+002D (-)
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x00},   // U+002E (.)
-    { 0x60, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x00},   // U+002F (/)
-    { 0x3E, 0x63, 0x73, 0x7B, 0x6F, 0x67, 0x3E, 0x00},   // U+0030 (0)
-    { 0x0C, 0x0E, 0x0C, 0x0C, 0x0C, 0x0C, 0x3F, 0x00},   // U+0031 (1)
-    { 0x1E, 0x33, 0x30, 0x1C, 0x06, 0x33, 0x3F, 0x00},   // U+0032 (2)
-    { 0x1E, 0x33, 0x30, 0x1C, 0x30, 0x33, 0x1E, 0x00},   // U+0033 (3)
-    { 0x38, 0x3C, 0x36, 0x33, 0x7F, 0x30, 0x78, 0x00},   // U+0034 (4)
-    { 0x3F, 0x03, 0x1F, 0x30, 0x30, 0x33, 0x1E, 0x00},   // U+0035 (5)
-    { 0x1C, 0x06, 0x03, 0x1F, 0x33, 0x33, 0x1E, 0x00},   // U+0036 (6)
-    { 0x3F, 0x33, 0x30, 0x18, 0x0C, 0x0C, 0x0C, 0x00},   // U+0037 (7)
-    { 0x1E, 0x33, 0x33, 0x1E, 0x33, 0x33, 0x1E, 0x00},   // U+0038 (8)
-    { 0x1E, 0x33, 0x33, 0x3E, 0x30, 0x18, 0x0E, 0x00},   // U+0039 (9)
-    { 0x00, 0x0C, 0x0C, 0x00, 0x00, 0x0C, 0x0C, 0x00},   // U+003A (:)
-    { 0x00, 0x0C, 0x0C, 0x00, 0x00, 0x0C, 0x0C, 0x06},   // U+003B (;)
-    { 0x18, 0x0C, 0x06, 0x03, 0x06, 0x0C, 0x18, 0x00},   // U+003C (<)
-    { 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00},   // U+003D (=)
-    { 0x06, 0x0C, 0x18, 0x30, 0x18, 0x0C, 0x06, 0x00},   // U+003E (>)
-    { 0x1E, 0x33, 0x30, 0x18, 0x0C, 0x00, 0x0C, 0x00},   // U+003F (?)
-    { 0x3E, 0x63, 0x7B, 0x7B, 0x7B, 0x03, 0x1E, 0x00},   // U+0040 (@)
-    { 0x0C, 0x1E, 0x33, 0x33, 0x3F, 0x33, 0x33, 0x00},   // U+0041 (A)
-    { 0x3F, 0x66, 0x66, 0x3E, 0x66, 0x66, 0x3F, 0x00},   // U+0042 (B)
-    { 0x3C, 0x66, 0x03, 0x03, 0x03, 0x66, 0x3C, 0x00},   // U+0043 (C)
-    { 0x1F, 0x36, 0x66, 0x66, 0x66, 0x36, 0x1F, 0x00},   // U+0044 (D)
-    { 0x7F, 0x46, 0x16, 0x1E, 0x16, 0x46, 0x7F, 0x00},   // U+0045 (E)
-    { 0x7F, 0x46, 0x16, 0x1E, 0x16, 0x06, 0x0F, 0x00},   // U+0046 (F)
-    { 0x3C, 0x66, 0x03, 0x03, 0x73, 0x66, 0x7C, 0x00},   // U+0047 (G)
-    { 0x33, 0x33, 0x33, 0x3F, 0x33, 0x33, 0x33, 0x00},   // U+0048 (H)
-    { 0x1E, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x1E, 0x00},   // U+0049 (I)
-    { 0x78, 0x30, 0x30, 0x30, 0x33, 0x33, 0x1E, 0x00},   // U+004A (J)
-    { 0x67, 0x66, 0x36, 0x1E, 0x36, 0x66, 0x67, 0x00},   // U+004B (K)
-    { 0x0F, 0x06, 0x06, 0x06, 0x46, 0x66, 0x7F, 0x00},   // U+004C (L)
-    { 0x63, 0x77, 0x7F, 0x7F, 0x6B, 0x63, 0x63, 0x00},   // U+004D (M)
-    { 0x63, 0x67, 0x6F, 0x7B, 0x73, 0x63, 0x63, 0x00},   // U+004E (N)
-    { 0x1C, 0x36, 0x63, 0x63, 0x63, 0x36, 0x1C, 0x00},   // U+004F (O)
-    { 0x3F, 0x66, 0x66, 0x3E, 0x06, 0x06, 0x0F, 0x00},   // U+0050 (P)
-    { 0x1E, 0x33, 0x33, 0x33, 0x3B, 0x1E, 0x38, 0x00},   // U+0051 (Q)
-    { 0x3F, 0x66, 0x66, 0x3E, 0x36, 0x66, 0x67, 0x00},   // U+0052 (R)
-    { 0x1E, 0x33, 0x07, 0x0E, 0x38, 0x33, 0x1E, 0x00},   // U+0053 (S)
-    { 0x3F, 0x2D, 0x0C, 0x0C, 0x0C, 0x0C, 0x1E, 0x00},   // U+0054 (T)
-    { 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3F, 0x00},   // U+0055 (U)
-    { 0x33, 0x33, 0x33, 0x33, 0x33, 0x1E, 0x0C, 0x00},   // U+0056 (V)
-    { 0x63, 0x63, 0x63, 0x6B, 0x7F, 0x77, 0x63, 0x00},   // U+0057 (W)
-    { 0x63, 0x63, 0x36, 0x1C, 0x1C, 0x36, 0x63, 0x00},   // U+0058 (X)
-    { 0x33, 0x33, 0x33, 0x1E, 0x0C, 0x0C, 0x1E, 0x00},   // U+0059 (Y)
-    { 0x7F, 0x63, 0x31, 0x18, 0x4C, 0x66, 0x7F, 0x00},   // U+005A (Z)
-    { 0x1E, 0x06, 0x06, 0x06, 0x06, 0x06, 0x1E, 0x00},   // U+005B ([)
-    { 0x03, 0x06, 0x0C, 0x18, 0x30, 0x60, 0x40, 0x00},   // U+005C (\)
-    { 0x1E, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1E, 0x00},   // U+005D (])
-    { 0x08, 0x1C, 0x36, 0x63, 0x00, 0x00, 0x00, 0x00},   // U+005E (^)
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF},   // U+005F (_)
-    { 0x0C, 0x0C, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00},   // U+0060 (`)
-    { 0x00, 0x00, 0x1E, 0x30, 0x3E, 0x33, 0x6E, 0x00},   // U+0061 (a)
-    { 0x07, 0x06, 0x06, 0x3E, 0x66, 0x66, 0x3B, 0x00},   // U+0062 (b)
-    { 0x00, 0x00, 0x1E, 0x33, 0x03, 0x33, 0x1E, 0x00},   // U+0063 (c)
-    { 0x38, 0x30, 0x30, 0x3e, 0x33, 0x33, 0x6E, 0x00},   // U+0064 (d)
-    { 0x00, 0x00, 0x1E, 0x33, 0x3f, 0x03, 0x1E, 0x00},   // U+0065 (e)
-    { 0x1C, 0x36, 0x06, 0x0f, 0x06, 0x06, 0x0F, 0x00},   // U+0066 (f)
-    { 0x00, 0x00, 0x6E, 0x33, 0x33, 0x3E, 0x30, 0x1F},   // U+0067 (g)
-    { 0x07, 0x06, 0x36, 0x6E, 0x66, 0x66, 0x67, 0x00},   // U+0068 (h)
-    { 0x0C, 0x00, 0x0E, 0x0C, 0x0C, 0x0C, 0x1E, 0x00},   // U+0069 (i)
-    { 0x30, 0x00, 0x30, 0x30, 0x30, 0x33, 0x33, 0x1E},   // U+006A (j)
-    { 0x07, 0x06, 0x66, 0x36, 0x1E, 0x36, 0x67, 0x00},   // U+006B (k)
-    { 0x0E, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x1E, 0x00},   // U+006C (l)
-    { 0x00, 0x00, 0x33, 0x7F, 0x7F, 0x6B, 0x63, 0x00},   // U+006D (m)
-    { 0x00, 0x00, 0x1F, 0x33, 0x33, 0x33, 0x33, 0x00},   // U+006E (n)
-    { 0x00, 0x00, 0x1E, 0x33, 0x33, 0x33, 0x1E, 0x00},   // U+006F (o)
-    { 0x00, 0x00, 0x3B, 0x66, 0x66, 0x3E, 0x06, 0x0F},   // U+0070 (p)
-    { 0x00, 0x00, 0x6E, 0x33, 0x33, 0x3E, 0x30, 0x78},   // U+0071 (q)
-    { 0x00, 0x00, 0x3B, 0x6E, 0x66, 0x06, 0x0F, 0x00},   // U+0072 (r)
-    { 0x00, 0x00, 0x3E, 0x03, 0x1E, 0x30, 0x1F, 0x00},   // U+0073 (s)
-    { 0x08, 0x0C, 0x3E, 0x0C, 0x0C, 0x2C, 0x18, 0x00},   // U+0074 (t)
-    { 0x00, 0x00, 0x33, 0x33, 0x33, 0x33, 0x6E, 0x00},   // U+0075 (u)
-    { 0x00, 0x00, 0x33, 0x33, 0x33, 0x1E, 0x0C, 0x00},   // U+0076 (v)
-    { 0x00, 0x00, 0x63, 0x6B, 0x7F, 0x7F, 0x36, 0x00},   // U+0077 (w)
-    { 0x00, 0x00, 0x63, 0x36, 0x1C, 0x36, 0x63, 0x00},   // U+0078 (x)
-    { 0x00, 0x00, 0x33, 0x33, 0x33, 0x3E, 0x30, 0x1F},   // U+0079 (y)
-    { 0x00, 0x00, 0x3F, 0x19, 0x0C, 0x26, 0x3F, 0x00},   // U+007A (z)
-    { 0x38, 0x0C, 0x0C, 0x07, 0x0C, 0x0C, 0x38, 0x00},   // U+007B ({)
-    { 0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x18, 0x00},   // U+007C (|)
-    { 0x07, 0x0C, 0x0C, 0x38, 0x0C, 0x0C, 0x07, 0x00},   // U+007D (})
-    { 0x6E, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},   // U+007E (~)
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}    // U+007F
-};
+// Spread of a tile's cell means below which it is treated as flat rather than matched by shape
+static const float shape_min_contrast = 0.1f;
+
+// Codepoints past U+007F take two or three bytes; the font has nothing past U+FFFF. Returns the
+// end of what was written.
+static char* encodeUtf8(char32_t codepoint, char* out) {
+    if (codepoint < 0x80) {
+        *out++ = static_cast<char>(codepoint);
+    } else if (codepoint < 0x800) {
+        *out++ = static_cast<char>(0xC0 | (codepoint >> 6));
+        *out++ = static_cast<char>(0x80 | (codepoint & 0x3F));
+    } else {
+        *out++ = static_cast<char>(0xE0 | (codepoint >> 12));
+        *out++ = static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+        *out++ = static_cast<char>(0x80 | (codepoint & 0x3F));
+    }
+    return out;
+}
 
-// Font8x8 block characters (U+2580 to U+259F)
-const unsigned char AsciiDithrer::font8x8_block[32][8] = {
-    { 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00},   // U+2580 (top half)
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF},   // U+2581 (box 1/8)
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF},   // U+2582 (box 2/8)
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF},   // U+2583 (box 3/8)
-    { 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF},   // U+2584 (bottom half)
-    { 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF},   // U+2585 (box 5/8)
-    { 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF},   // U+2586 (box 6/8)
-    { 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF},   // U+2587 (box 7/8)
-    { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF},   // U+2588 (solid)
-    { 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F},   // U+2589 (box 7/8)
-    { 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F},   // U+258A (box 6/8)
-    { 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F},   // U+258B (box 5/8)
-    { 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F},   // U+258C (left half)
-    { 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07},   // U+258D (box 3/8)
-    { 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03},   // U+258E (box 2/8)
-    { 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01},   // U+258F (box 1/8)
-    { 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0},   // U+2590 (right half)
-    { 0x55, 0x00, 0xAA, 0x00, 0x55, 0x00, 0xAA, 0x00},   // U+2591 (25% solid)
-    { 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA},   // U+2592 (50% solid)
-    { 0xFF, 0xAA, 0xFF, 0x55, 0xFF, 0xAA, 0xFF, 0x55},   // U+2593 (75% solid)
-    { 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},   // U+2594 (box 1/8)
-    { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},   // U+2595 (box 1/8)
-    { 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x0F, 0x0F},   // U+2596 (box bottom left)
-    { 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0xF0, 0xF0},   // U+2597 (box bottom right)
-    { 0x0F, 0x0F, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00},   // U+2598 (box top left)
-    { 0x0F, 0x0F, 0x0F, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF},   // U+2599 (boxes left and bottom)
-    { 0x0F, 0x0F, 0x0F, 0x0F, 0xF0, 0xF0, 0xF0, 0xF0},   // U+259A (boxes top-left and bottom right)
-    { 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x0F, 0x0F, 0x0F},   // U+259B (boxes top and left)
-    { 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0},   // U+259C (boxes top and right)
-    { 0xF0, 0xF0, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x00},   // U+259D (box top right)
-    { 0xF0, 0xF0, 0xF0, 0xF0, 0x0F, 0x0F, 0x0F, 0x0F},   // U+259E (boxes top right and bottom left)
-    { 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF}    // U+259F (boxes right and bottom)
-};
+// The whole text in one write
+static bool writeText(const std::string& filename, const std::string& text) {
+    std::ofstream file(filename);
+    if (!file.is_open()) return false;
+    file.write(text.data(), static_cast<std::streamsize>(text.size()));
+    return static_cast<bool>(file);
+}
 
 AsciiDithrer::AsciiDithrer(AsciiCharSet charSet, bool detectEdges)
     : charSet_(charSet), detectEdges_(detectEdges),
       edgeThreshold_(0.3f), contrast_(1.0f), brightness_(0.0f), gamma_(1.0f),
-      dogSigma_(1.0f), dogSigmaScale_(1.6f), dogTau_(1.0f), dogThreshold_(0.02f), edgePixelThreshold_(8),
+      dogSigma_(1.0f), dogSigmaScale_(1.6f), dogTau_(1.0f), dogThreshold_(0.02f), dogEdges_(false), edgePixelThreshold_(8),
       colorTheme_(ColorTheme::MONOCHROME), depthMode_(DepthMode::NONE), depthThreshold_(0.5f), depthFade_(0.3f),
-      bloomIntensity_(0.1f), colorBurn_(0.0f), toneMapping_(1.0f), lowContrast_(false), tileSize_(8), computeShaderMode_(false) {
+      bloomIntensity_(0.1f), bloomSigma_(2.0f), colorBurn_(0.0f), toneMapping_(1.0f), lowContrast_(false), tileSize_(8), computeShaderMode_(false),
+      glyphMatching_(GlyphMatching::NONE) {
     initializeCharMap();
 }
 
 void AsciiDithrer::initializeCharMap() {
+    shapes_ = &glyph_ramps::printableShapes;
     switch (charSet_) {
         case AsciiCharSet::BASIC:
-            charMap_ = " .:-=+*#%@";
+            ramp_ = &glyph_ramps::basic;
             break;
         case AsciiCharSet::EXTENDED:
-            charMap_ = " .'`^\",:;Il!i><~+_-?][}{1)(|\\/tfjrxnuvczXYUJCLQ0OZmwqpdbkhao*#MW&8%B@$";
+        case AsciiCharSet::SHADER:
+            ramp_ = &glyph_ramps::extended;
             break;
         case AsciiCharSet::ARTISTIC:
-            charMap_ = " ░▒▓█";
+            ramp_ = &glyph_ramps::artistic;
+            shapes_ = &glyph_ramps::blockShapes;
             break;
         case AsciiCharSet::SIMPLE:
-            charMap_ = ".#";
-            break;
-        case AsciiCharSet::SHADER:
-            charMap_ = " .'`^\",:;Il!i><~+_-?][}{1)(|\\/tfjrxnuvczXYUJCLQ0OZmwqpdbkhao*#MW&8%B@$";
+            ramp_ = &glyph_ramps::simple;
             break;
         case AsciiCharSet::RETRO:
-            charMap_ = " █";
+            ramp_ = &glyph_ramps::retro;
+            shapes_ = &glyph_ramps::blockShapes;
             break;
         case AsciiCharSet::ADVANCED:
-            charMap_ = luminance_chars;
-            break;
         case AsciiCharSet::FONT8X8:
-            charMap_ = luminance_chars;
+        default:
+            ramp_ = &glyph_ramps::basic;
             break;
     }
 }
 
-float AsciiDithrer::getBrightness(const Color& color) {
+float AsciiDithrer::getBrightness(const Color& color) const {
     return 0.299f * color.r + 0.587f * color.g + 0.114f * color.b;
 }
 
-float AsciiDithrer::applyImageProcessing(float value) {
+float AsciiDithrer::applyImageProcessing(float value) const {
     value += brightness_;
     value = (value - 0.5f) * contrast_ + 0.5f;
     if (gamma_ != 1.0f) value = std::pow(value, gamma_);
@@ -231,111 +91,91 @@ float AsciiDithrer::applyImageProcessing(float value) {
 }
 
 // --- DoG and Sobel routines ---
-float AsciiDithrer::gaussian(float sigma, float pos) {
-    return (1.0f / std::sqrt(2.0f * M_PI * sigma * sigma)) * std::exp(-(pos * pos) / (2.0f * sigma * sigma));
-}
-
-void AsciiDithrer::calculateLuminanceBuffer(const Image& image) {
-    int width = image.getWidth();
-    int height = image.getHeight();
-    luminanceBuffer_.resize(width * height);
-    for (int y = 0; y < height; ++y) {
-        for (int x = 0; x < width; ++x) {
-            luminanceBuffer_[y * width + x] = getBrightness(image.getPixel(x, y));
-        }
-    }
-}
-
-void AsciiDithrer::horizontalBlur(std::vector<float>& input, std::vector<float>& output, int width, int height) {
-    output.resize(width * height);
-    int ksize = static_cast<int>(std::ceil(dogSigma_ * 3));
-    for (int y = 0; y < height; ++y) {
-        for (int x = 0; x < width; ++x) {
-            float sum = 0.0f, wsum = 0.0f;
-            for (int k = -ksize; k <= ksize; ++k) {
-                int xx = clampi(x + k, 0, width - 1);
-                float w = gaussian(dogSigma_, k);
-                sum += input[y * width + xx] * w;
-                wsum += w;
+void AsciiDithrer::calculateLuminanceBuffer(const Image& image, Frame& frame) const {
+    int width = frame.width = image.getWidth();
+    int height = frame.height = image.getHeight();
+    frame.luminance.resize(width * height);
+    thread_pool::parallelFor(0, height, 0, [&](int first, int last) {
+        for (int y = first; y < last; ++y) {
+            for (int x = 0; x < width; ++x) {
+                frame.luminance[y * width + x] = getBrightness(image.getPixel(x, y));
             }
-            output[y * width + x] = sum / wsum;
         }
-    }
-}
-
-void AsciiDithrer::verticalBlur(std::vector<float>& input, std::vector<float>& output, int width, int height) {
-    output.resize(width * height);
-    int ksize = static_cast<int>(std::ceil(dogSigma_ * 3));
-    for (int y = 0; y < height; ++y) {
-        for (int x = 0; x < width; ++x) {
-            float sum = 0.0f, wsum = 0.0f;
-            for (int k = -ksize; k <= ksize; ++k) {
-                int yy = clampi(y + k, 0, height - 1);
-                float w = gaussian(dogSigma_, k);
-                sum += input[yy * width + x] * w;
-                wsum += w;
+    });
+    frame.luminanceTable.build(frame.luminance.data(), width, height);
+}
+
+void AsciiDithrer::applyDifferenceOfGaussians(Frame& frame) const {
+    // DoG = blur(sigma) - tau * blur(sigma * scale)
+    frame.dog.resize(frame.width * frame.height);
+    gaussian_blur::difference(frame.luminance.data(), frame.dog.data(), frame.width, frame.height,
+                              dogSigma_, dogSigma_ * dogSigmaScale_, dogTau_);
+}
+
+void AsciiDithrer::applySobelFilter(Frame& frame) const {
+    // Sobel magnitude of the DoG, oriented wherever it passes dogThreshold_; the border stays 0
+    int width = frame.width, height = frame.height;
+    frame.edgeStrength.assign(width * height, 0.0f);
+    frame.edgeOrientation.assign(width * height, EdgeDirection::NONE);
+    if (width < 3 || height < 3) return;
+    thread_pool::parallelFor(1, height - 1, 0, [&](int first, int last) {
+        std::vector<float> gx(width), gy(width);
+        for (int y = first; y < last; ++y) {
+            const float* row = &frame.dog[y * width];
+            float* strength = &frame.edgeStrength[y * width];
+            filter_kernels::sobelRow(row - width, row, row + width, width, gx.data(), gy.data(), strength);
+            for (int x = 1; x < width - 1; ++x) {
+                if (strength[x] > dogThreshold_) {
+                    frame.edgeOrientation[y * width + x] = getEdgeDirection(std::atan2(gy[x], gx[x]));
+                }
             }
-            output[y * width + x] = sum / wsum;
         }
-    }
-}
-
-void AsciiDithrer::applyDifferenceOfGaussians() {
-    // DoG: blur with sigma, blur with sigma*scale, subtract
-    int width = static_cast<int>(std::sqrt(luminanceBuffer_.size()));
-    int height = luminanceBuffer_.size() / width;
-    std::vector<float> blur1, blur2, temp;
-    // Horizontal + vertical blur for both sigmas
-    horizontalBlur(luminanceBuffer_, temp, width, height);
-    verticalBlur(temp, blur1, width, height);
-    float sigma2 = dogSigma_ * dogSigmaScale_;
-    int ksize2 = static_cast<int>(std::ceil(sigma2 * 3));
-    // Blur2: use sigma2
-    // Horizontal
-    temp.resize(width * height);
-    for (int y = 0; y < height; ++y) {
-        for (int x = 0; x < width; ++x) {
-            float sum = 0.0f, wsum = 0.0f;
-            for (int k = -ksize2; k <= ksize2; ++k) {
-                int xx = clampi(x + k, 0, width - 1);
-                float w = gaussian(sigma2, k);
-                sum += luminanceBuffer_[y * width + xx] * w;
-                wsum += w;
+    });
+}
+
+void AsciiDithrer::calculateGradientField(Frame& frame) const {
+    int width = frame.width, height = frame.height;
+    frame.edgeStrength.assign(width * height, 0.0f);
+    frame.edgeOrientation.assign(width * height, EdgeDirection::NONE);
+    if (width < 3 || height < 3) return;
+    // Sobel magnitude of the luminance, normalized to [0, 1]; the one-pixel border stays 0. The
+    // orientation is taken across the magnitude field itself, so row y is oriented right after
+    // row y + 1's magnitude is in. The vector sqrt is correctly rounded, so both fields are
+    // bit-identical to computing each pixel on its own.
+    thread_pool::parallelFor(1, height - 1, 0, [&](int first, int last) {
+        std::vector<float> gx(width), gy(width);
+        // Magnitude of rows first - 1 and last, which belong to the neighboring chunks
+        std::vector<float> halo(2 * width, 0.0f);
+        auto strengthRow = [&](int y) {
+            if (y == first - 1) return halo.data();
+            if (y == last) return halo.data() + width;
+            return &frame.edgeStrength[y * width];
+        };
+        auto magnitudeRow = [&](int y) {
+            if (y < 1 || y >= height - 1) return;
+            const float* row = &frame.luminance[y * width];
+            float* strength = strengthRow(y);
+            filter_kernels::sobelRow(row - width, row, row + width, width, gx.data(), gy.data(), strength);
+            for (int x = 1; x < width - 1; ++x) strength[x] /= 1020.0f;
+        };
+        magnitudeRow(first - 1);
+        magnitudeRow(first);
+        for (int y = first; y < last; ++y) {
+            magnitudeRow(y + 1);
+            const float* above = strengthRow(y - 1);
+            const float* strength = strengthRow(y);
+            const float* below = strengthRow(y + 1);
+            for (int x = 1; x < width - 1; ++x) {
+                if (strength[x] > edgeThreshold_) {
+                    frame.edgeOrientation[y * width + x] = getEdgeDirection(atan2(
+                        below[x] - above[x], strength[x + 1] - strength[x - 1]));
+                }
             }
-            temp[y * width + x] = sum / wsum;
         }
-    }
-    verticalBlur(temp, blur2, width, height);
-    // DoG = blur1 - tau * blur2
-    dogBuffer_.resize(width * height);
-    for (int i = 0; i < width * height; ++i) {
-        dogBuffer_[i] = blur1[i] - dogTau_ * blur2[i];
-    }
+    });
 }
 
-void AsciiDithrer::applySobelFilter() {
-    int width = static_cast<int>(std::sqrt(dogBuffer_.size()));
-    int height = dogBuffer_.size() / width;
-    edgeBuffer_.resize(width * height);
-    edgeDirectionBuffer_.resize(width * height);
-    for (int y = 1; y < height - 1; ++y) {
-        for (int x = 1; x < width - 1; ++x) {
-            float gx =
-                -1 * dogBuffer_[(y - 1) * width + (x - 1)] + 1 * dogBuffer_[(y - 1) * width + (x + 1)] +
-                -2 * dogBuffer_[y * width + (x - 1)] + 2 * dogBuffer_[y * width + (x + 1)] +
-                -1 * dogBuffer_[(y + 1) * width + (x - 1)] + 1 * dogBuffer_[(y + 1) * width + (x + 1)];
-            float gy =
-                -1 * dogBuffer_[(y - 1) * width + (x - 1)] + -2 * dogBuffer_[(y - 1) * width + x] + -1 * dogBuffer_[(y - 1) * width + (x + 1)] +
-                1 * dogBuffer_[(y + 1) * width + (x - 1)] + 2 * dogBuffer_[(y + 1) * width + x] + 1 * dogBuffer_[(y + 1) * width + (x + 1)];
-            float mag = std::sqrt(gx * gx + gy * gy);
-            float theta = std::atan2(gy, gx);
-            edgeBuffer_[y * width + x] = mag;
-            edgeDirectionBuffer_[y * width + x] = getEdgeDirection(theta);
-        }
-    }
-}
-
-EdgeDirection AsciiDithrer::getEdgeDirection(float theta) {
+EdgeDirection AsciiDithrer::getEdgeDirection(float theta) const {
     float deg = theta * 180.0f / M_PI;
     deg = std::fmod(deg + 360.0f, 360.0f); // [0,360)
     if ((deg < 22.5f) || (deg >= 157.5f && deg < 202.5f) || (deg >= 337.5f)) return EdgeDirection::VERTICAL;
@@ -346,14 +186,12 @@ EdgeDirection AsciiDithrer::getEdgeDirection(float theta) {
 }
 
 // --- Main ASCII logic ---
-char AsciiDithrer::getAdvancedChar(int x, int y, float brightness, EdgeDirection direction) {
+char AsciiDithrer::getAdvancedChar(int x, int y, float brightness, EdgeDirection direction) const {
     if (direction != EdgeDirection::NONE) {
         return edge_chars[static_cast<int>(direction)];
     } else {
         // Map brightness to luminance ramp
-        brightness = applyImageProcessing(brightness);
-        int idx = static_cast<int>(brightness * (std::strlen(luminance_chars) - 1));
-        return luminance_chars[idx];
+        return static_cast<char>(glyph_ramps::basic.glyphs[glyph_ramps::level(applyImageProcessing(brightness))]);
     }
 }
 
@@ -362,75 +200,77 @@ void AsciiDithrer::applyDither(const Image& inputImage, Image& outputImage, cons
     outputImage = inputImage;
 }
 
-// Map brightness [0,1] to a font8x8 character (basic set, ASCII 32-126)
-char AsciiDithrer::selectFont8x8Char(float brightness) {
-    // Map brightness to printable ASCII range (32-126)
-    int numChars = 95; // 126-32+1
-    int idx = static_cast<int>(brightness * (numChars - 1));
-    idx = clampi(idx, 0, numChars - 1);
-    return static_cast<char>(32 + idx);
+// Map brightness [0,1] to a font8x8 character (basic set, ASCII 32-126), by ink coverage
+char AsciiDithrer::selectFont8x8Char(float brightness) const {
+    return static_cast<char>(glyph_ramps::printable.glyphs[glyph_ramps::level(brightness)]);
 }
 
-// Render an 8x8 tile using the font8x8 bitmap for the given character
-void AsciiDithrer::renderFont8x8Tile(std::ofstream& file, char asciiChar) {
-    int fontIdx = static_cast<unsigned char>(asciiChar);
-    if (fontIdx < 0 || fontIdx > 127) fontIdx = 32; // fallback to space
-    const unsigned char* bitmap = font8x8_basic[fontIdx];
-    for (int row = 0; row < 8; ++row) {
-        for (int col = 0; col < 8; ++col) {
-            bool pixelOn = (bitmap[row] & (1 << (7 - col)));
-            file << (pixelOn ? '#' : ' ');
-        }
-        file << '\n';
+// One row of the font8x8 bitmap for the given character, as 8 of '#' and ' '
+void AsciiDithrer::renderFont8x8Row(char32_t glyph, int row, char* out) const {
+    const unsigned char* bitmap = font8x8::glyph(glyph);
+    if (!bitmap) bitmap = font8x8::basic[' ']; // fallback to space
+    for (int col = 0; col < 8; ++col) {
+        out[col] = (bitmap[row] >> col) & 1 ? '#' : ' '; // bit 0 is the leftmost pixel
     }
 }
 
+bool AsciiDithrer::saveAsText(const Image& inputImage, const std::string& filename) const {
+    std::string text;
+    return renderAsText(inputImage, text) && writeText(filename, text);
+}
+
 // --- Update saveAsText for FONT8X8 mode ---
-bool AsciiDithrer::saveAsText(const Image& inputImage, const std::string& filename) {
+bool AsciiDithrer::renderAsText(const Image& inputImage, std::string& text) const {
     int width = inputImage.getWidth();
     int height = inputImage.getHeight();
     int tileSize = 8; // 8x8 tiles
     int tilesX = width / tileSize;
     int tilesY = height / tileSize;
     if (tilesX < 1 || tilesY < 1) return false;
+    // The other sets write a character per tile rather than its bitmap
+    if (charSet_ != AsciiCharSet::FONT8X8) return renderAsTextAdvanced(inputImage, text);
 
-    calculateLuminanceBuffer(inputImage);
-    std::ofstream file(filename);
-    if (!file.is_open()) return false;
+    Frame frame;
+    calculateLuminanceBuffer(inputImage, frame);
 
-    if (charSet_ == AsciiCharSet::FONT8X8) {
-        // Render each tile as an 8x8 ASCII block
-        for (int ty = 0; ty < tilesY; ++ty) {
+    // Every tile's glyph up front, in parallel
+    std::vector<char32_t> glyphs(tilesX * tilesY);
+    thread_pool::parallelFor(0, tilesY, 0, [&](int first, int last) {
+        for (int ty = first; ty < last; ++ty) {
+            for (int tx = 0; tx < tilesX; ++tx) {
+                // Compute average brightness for this tile
+                float avgBrightness = frame.luminanceTable.mean(tx * tileSize, ty * tileSize,
+                                                                (tx + 1) * tileSize, (ty + 1) * tileSize);
+                glyph_match::TileMask shape;
+                glyphs[ty * tilesX + tx] = glyphMatching_ != GlyphMatching::NONE &&
+                                                   tileShape(frame, tx * tileSize, ty * tileSize, (tx + 1) * tileSize,
+                                                             (ty + 1) * tileSize, shape)
+                                               ? matchGlyph(shape)
+                                               : selectFont8x8Char(applyImageProcessing(avgBrightness));
+            }
+        }
+    });
+
+    // Render each tile as an 8x8 ASCII block. Every line has the same length, so each tile row
+    // goes straight to its place in the text.
+    size_t lineLength = static_cast<size_t>(tilesX) * tileSize + 1;
+    text.assign(lineLength * tilesY * tileSize, '\n');
+    thread_pool::parallelFor(0, tilesY, 0, [&](int first, int last) {
+        for (int ty = first; ty < last; ++ty) {
             // For each row of the tile
             for (int row = 0; row < tileSize; ++row) {
+                char* line = &text[(static_cast<size_t>(ty) * tileSize + row) * lineLength];
                 for (int tx = 0; tx < tilesX; ++tx) {
-                    // Compute average brightness for this tile
-                    float avgBrightness = 0.0f;
-                    for (int dy = 0; dy < tileSize; ++dy) {
-                        for (int dx = 0; dx < tileSize; ++dx) {
-                            int x = tx * tileSize + dx;
-                            int y = ty * tileSize + dy;
-                            int idx = y * width + x;
-                            avgBrightness += luminanceBuffer_[idx];
-                        }
-                    }
-                    avgBrightness /= (tileSize * tileSize);
-                    char asciiChar = selectFont8x8Char(applyImageProcessing(avgBrightness));
                     // Output the row of the font8x8 bitmap
-                    renderFont8x8Tile(file, asciiChar);
+                    renderFont8x8Row(glyphs[ty * tilesX + tx], row, line + tx * tileSize);
                 }
-                file << '\n';
             }
         }
-        file.close();
-        return true;
-    }
-    // ... fallback to previous logic for other charsets ...
-    // ... existing code ...
-    return false;
+    });
+    return true;
 }
 
-bool AsciiDithrer::saveAsAsciiImage(const Image& inputImage, const std::string& filename, const Color& fg, const Color& bg, int scale) {
+bool AsciiDithrer::saveAsAsciiImage(const Image& inputImage, const std::string& filename, const Color& fg, const Color& bg, int scale) const {
     int width = inputImage.getWidth();
     int height = inputImage.getHeight();
     int tilesX = width / tileSize_;
@@ -438,101 +278,82 @@ bool AsciiDithrer::saveAsAsciiImage(const Image& inputImage, const std::string&
     if (tilesX < 1 || tilesY < 1) return false;
     int outW = tilesX * tileSize_ * scale;
     int outH = tilesY * tileSize_ * scale;
-    Image outImg(outW, outH);
+    // Rendered straight to the RGBA8 bytes that get written
+    std::vector<unsigned char> frame(4 * static_cast<size_t>(outW) * outH);
+    unsigned char rgba[4];
+    pixel_kernels::colorsToRgba8(&bg, rgba, 1);
+    uint32_t bgPixel = glyph_blit::pack(rgba);
     
     // Fill background
-    for (int y = 0; y < outH; ++y) {
-        for (int x = 0; x < outW; ++x) {
-            outImg.setPixel(x, y, bg);
-        }
-    }
+    thread_pool::parallelFor(0, outH, 0, [&](int first, int last) {
+        glyph_blit::fill(&frame[4 * static_cast<size_t>(first) * outW], (last - first) * outW, bgPixel);
+    });
     
-    // Process tiles using advanced shader techniques
+    // Process tiles using advanced shader techniques (this computes the luminance buffer too)
+    Frame analysis;
     if (computeShaderMode_) {
-        processTiles(inputImage);
+        processTiles(inputImage, analysis);
+    } else {
+        calculateLuminanceBuffer(inputImage, analysis);
     }
     
-    calculateLuminanceBuffer(inputImage);
-    
-    for (int ty = 0; ty < tilesY; ++ty) {
-        for (int tx = 0; tx < tilesX; ++tx) {
-            TileInfo tile;
+    thread_pool::parallelFor(0, tilesY, 0, [&](int first, int last) {
+        // A cache per chunk, so the workers never share one
+        glyph_blit::TileCache cache(tileSize_, scale);
+        for (int ty = first; ty < last; ++ty) {
+            for (int tx = 0; tx < tilesX; ++tx) {
+                TileInfo tile;
             
-            if (computeShaderMode_ && !tileBuffer_.empty()) {
-                int tileIndex = ty * tilesX + tx;
-                if (tileIndex < tileBuffer_.size()) {
-                    tile = tileBuffer_[tileIndex];
+                if (computeShaderMode_) {
+                    tile = analysis.tiles[ty * tilesX + tx];
                 } else {
-                    tile = analyzeTile(inputImage, tx, ty);
-                }
-            } else {
-                // Compute average brightness for this tile
-                float avgBrightness = 0.0f;
-                for (int dy = 0; dy < tileSize_; ++dy) {
-                    for (int dx = 0; dx < tileSize_; ++dx) {
-                        int x = tx * tileSize_ + dx;
-                        int y = ty * tileSize_ + dy;
-                        if (x < width && y < height) {
-                            int idx = y * width + x;
-                            avgBrightness += luminanceBuffer_[idx];
-                        }
-                    }
+                    // Compute average brightness for this tile
+                    float avgBrightness = analysis.luminanceTable.mean(tx * tileSize_, ty * tileSize_,
+                                                                       (tx + 1) * tileSize_, (ty + 1) * tileSize_);
+                    tile.averageLuminance = avgBrightness;
+                    tile.depth = 1.0f - avgBrightness / 255.0f;
+                    tile.dominantEdge = EdgeDirection::NONE;
+                    tile.hasSignificantEdges = false;
+                    tile.hasShape = glyphMatching_ != GlyphMatching::NONE &&
+                                    tileShape(analysis, tx * tileSize_, ty * tileSize_, (tx + 1) * tileSize_,
+                                              (ty + 1) * tileSize_, tile.shape);
                 }
-                avgBrightness /= (tileSize_ * tileSize_);
-                tile.averageLuminance = avgBrightness;
-                tile.depth = 1.0f - avgBrightness / 255.0f;
-                tile.dominantEdge = EdgeDirection::NONE;
-                tile.hasSignificantEdges = false;
-            }
-            
-            // Apply depth thresholding
-            if (depthMode_ != DepthMode::NONE && tile.depth > depthThreshold_) {
-                continue; // Skip distant tiles
-            }
             
-            char asciiChar = selectTileCharacter(tile);
-            if (asciiChar == 0) asciiChar = selectFont8x8Char(applyImageProcessing(tile.averageLuminance));
+                // Apply depth thresholding
+                if (depthMode_ != DepthMode::NONE && tile.depth > depthThreshold_) {
+                    continue; // Skip distant tiles
+                }
             
-            int fontIdx = static_cast<unsigned char>(asciiChar);
-            if (fontIdx < 0 || fontIdx > 127) fontIdx = 32;
-            const unsigned char* bitmap = font8x8_basic[fontIdx];
+                char32_t glyph = selectTileCharacter(tile);
+                if (glyph == 0) glyph = selectFont8x8Char(applyImageProcessing(tile.averageLuminance));
             
-            // Apply color theming
-            Color tileFg = fg;
-            if (colorTheme_ != ColorTheme::MONOCHROME) {
-                tileFg = applyColorTheme(fg, tile.averageLuminance, tile.depth);
-            }
+                const unsigned char* bitmap = font8x8::glyph(glyph);
+                if (!bitmap) bitmap = font8x8::basic[' '];
             
-            // Render the 8x8 bitmap into the output image
-            for (int row = 0; row < tileSize_; ++row) {
-                for (int col = 0; col < tileSize_; ++col) {
-                    bool pixelOn = (bitmap[row] & (1 << (7 - col)));
-                    Color color = pixelOn ? tileFg : bg;
-                    // Scale the tile if needed
-                    for (int sy = 0; sy < scale; ++sy) {
-                        for (int sx = 0; sx < scale; ++sx) {
-                            int outX = tx * tileSize_ * scale + col * scale + sx;
-                            int outY = ty * tileSize_ * scale + row * scale + sy;
-                            if (outX < outW && outY < outH) {
-                                outImg.setPixel(outX, outY, color);
-                            }
-                        }
-                    }
+                // Apply color theming
+                Color tileFg = fg;
+                if (colorTheme_ != ColorTheme::MONOCHROME) {
+                    tileFg = applyColorTheme(fg, tile.averageLuminance, tile.depth);
                 }
+                unsigned char fgRgba[4];
+                pixel_kernels::colorsToRgba8(&tileFg, fgRgba, 1);
+            
+                // Copy the glyph's scaled tile into the frame row by row
+                cache.blit(cache.tile(bitmap, glyph_blit::pack(fgRgba), bgPixel), frame.data(), outW,
+                           tx * cache.size(), ty * cache.size());
             }
         }
-    }
+    });
     
     // Apply post-processing effects if enabled
     if (bloomIntensity_ > 0.0f || colorBurn_ > 0.0f || toneMapping_ > 0.0f || lowContrast_) {
-        std::vector<Color> colors(outW * outH);
+        std::vector<Color> colors(static_cast<size_t>(outW) * outH);
         
-        // Extract colors from image
-        for (int y = 0; y < outH; ++y) {
-            for (int x = 0; x < outW; ++x) {
-                colors[y * outW + x] = outImg.getPixel(x, y);
-            }
-        }
+        // Extract colors from the frame
+        thread_pool::parallelFor(0, outH, 0, [&](int first, int last) {
+            size_t offset = static_cast<size_t>(first) * outW;
+            pixel_kernels::rgba8ToColors(&frame[offset * 4], &colors[offset], (last - first) * outW);
+        });
         
         // Apply effects
         if (bloomIntensity_ > 0.0f) {
@@ -548,85 +369,100 @@ bool AsciiDithrer::saveAsAsciiImage(const Image& inputImage, const std::string&
             applyLowContrastEffect(colors);
         }
         
-        // Write back to image
-        for (int y = 0; y < outH; ++y) {
-            for (int x = 0; x < outW; ++x) {
-                outImg.setPixel(x, y, colors[y * outW + x]);
-            }
-        }
+        // Write back to the frame
+        thread_pool::parallelFor(0, outH, 0, [&](int first, int last) {
+            size_t offset = static_cast<size_t>(first) * outW;
+            pixel_kernels::colorsToRgba8(&colors[offset], &frame[offset * 4], (last - first) * outW);
+        });
     }
     
-    return outImg.save(filename, "png");
+    return Image::saveRgba8(filename, "png", frame.data(), outW, outH);
 }
 
 // New advanced methods implementation
-void AsciiDithrer::processTiles(const Image& image) {
-    int width = image.getWidth();
-    int height = image.getHeight();
-    int numTilesX = width / tileSize_;
-    int numTilesY = height / tileSize_;
-    
-    tileBuffer_.resize(numTilesX * numTilesY);
-    
-    for (int tileY = 0; tileY < numTilesY; ++tileY) {
-        for (int tileX = 0; tileX < numTilesX; ++tileX) {
-            int tileIndex = tileY * numTilesX + tileX;
-            tileBuffer_[tileIndex] = analyzeTile(image, tileX, tileY);
+void AsciiDithrer::processTiles(const Image& image, Frame& frame) const {
+    // analyzeTile takes its luminance statistics from the summed-area table and its edges from
+    // the gradient field, so it never goes back to the image
+    calculateLuminanceBuffer(image, frame);
+    if (detectEdges_ && dogEdges_) {
+        applyDifferenceOfGaussians(frame);
+        applySobelFilter(frame);
+    } else if (detectEdges_) {
+        calculateGradientField(frame);
+    }
+    
+    frame.tilesX = frame.width / tileSize_;
+    frame.tilesY = frame.height / tileSize_;
+    frame.tiles.resize(frame.tilesX * frame.tilesY);
+    thread_pool::parallelFor(0, frame.tilesY, 0, [&](int first, int last) {
+        for (int tileY = first; tileY < last; ++tileY) {
+            for (int tileX = 0; tileX < frame.tilesX; ++tileX) {
+                int tileIndex = tileY * frame.tilesX + tileX;
+                frame.tiles[tileIndex] = analyzeTile(frame, tileX, tileY);
+            }
         }
-    }
+    });
 }
 
-TileInfo AsciiDithrer::analyzeTile(const Image& image, int tileX, int tileY) {
+std::vector<char32_t> AsciiDithrer::selectTileCharacters(const Frame& frame) const {
+    std::vector<char32_t> glyphs(frame.tiles.size());
+    thread_pool::parallelFor(0, frame.tilesY, 0, [&](int first, int last) {
+        for (size_t i = static_cast<size_t>(first) * frame.tilesX; i < static_cast<size_t>(last) * frame.tilesX; ++i) {
+            glyphs[i] = selectTileCharacter(frame.tiles[i]);
+            if (glyphs[i] == 0) glyphs[i] = selectFont8x8Char(applyImageProcessing(frame.tiles[i].averageLuminance));
+        }
+    });
+    return glyphs;
+}
+
+TileInfo AsciiDithrer::analyzeTile(const Frame& frame, int tileX, int tileY) const {
     TileInfo tile;
     tile.averageLuminance = 0.0f;
     tile.edgeStrength = 0.0f;
     tile.edgePixelCount = 0;
     tile.depth = 0.0f;
     tile.hasSignificantEdges = false;
+    tile.hasShape = false;
     
-    std::vector<EdgeDirection> edgeDirections;
-    std::vector<float> luminances;
+    int directionCounts[4] = {0, 0, 0, 0};
     
     int startX = tileX * tileSize_;
     int startY = tileY * tileSize_;
-    int endX = std::min(startX + tileSize_, image.getWidth());
-    int endY = std::min(startY + tileSize_, image.getHeight());
+    int endX = std::min(startX + tileSize_, frame.width);
+    int endY = std::min(startY + tileSize_, frame.height);
+    int pixelCount = (endX - startX) * (endY - startY);
+    if (pixelCount > 0) {
+        tile.averageLuminance = frame.luminanceTable.mean(startX, startY, endX, endY);
+        // Depth estimated from luminance: the mean of (1 - luminance) * 0.5
+        tile.depth = (1.0f - tile.averageLuminance) * 0.5f;
+        if (glyphMatching_ != GlyphMatching::NONE) {
+            tile.hasShape = tileShape(frame, startX, startY, endX, endY, tile.shape);
+        }
+    }
     
-    for (int y = startY; y < endY; ++y) {
-        for (int x = startX; x < endX; ++x) {
-            Color pixel = image.getPixel(x, y);
-            float luminance = getBrightness(pixel);
-            luminances.push_back(luminance);
-            tile.averageLuminance += luminance;
-            
-            // Calculate depth based on luminance (simplified depth estimation)
-            tile.depth += (1.0f - luminance) * 0.5f;
-            
-            if (detectEdges_ && isEdgePixel(image, x, y)) {
-                float edgeStrength = calculateEdgeStrength(image, x, y);
-                tile.edgeStrength += edgeStrength;
-                tile.edgePixelCount++;
-                
-                if (edgeStrength > edgeThreshold_) {
-                    EdgeDirection direction = getEdgeDirection(atan2(
-                        calculateEdgeStrength(image, x, y + 1) - calculateEdgeStrength(image, x, y - 1),
-                        calculateEdgeStrength(image, x + 1, y) - calculateEdgeStrength(image, x - 1, y)
-                    ));
-                    edgeDirections.push_back(direction);
+    // Edge statistics are a reduction over the precomputed gradient field
+    if (detectEdges_) {
+        float threshold = dogEdges_ ? dogThreshold_ : edgeThreshold_;
+        for (int y = startY; y < endY; ++y) {
+            const float* strength = &frame.edgeStrength[y * frame.width];
+            const EdgeDirection* orientation = &frame.edgeOrientation[y * frame.width];
+            for (int x = startX; x < endX; ++x) {
+                if (strength[x] > threshold) {
+                    tile.edgeStrength += strength[x];
+                    tile.edgePixelCount++;
+                    if (orientation[x] != EdgeDirection::NONE) {
+                        directionCounts[static_cast<int>(orientation[x])]++;
+                    }
                 }
             }
         }
     }
     
-    int pixelCount = (endX - startX) * (endY - startY);
     if (pixelCount > 0) {
-        tile.averageLuminance /= pixelCount;
-        tile.depth /= pixelCount;
-        
         if (tile.edgePixelCount > 0) {
             tile.edgeStrength /= tile.edgePixelCount;
             tile.hasSignificantEdges = tile.edgePixelCount >= edgePixelThreshold_;
-            tile.dominantEdge = getDominantEdgeDirection(edgeDirections);
+            tile.dominantEdge = getDominantEdgeDirection(directionCounts);
         } else {
             tile.dominantEdge = EdgeDirection::NONE;
         }
@@ -635,16 +471,7 @@ TileInfo AsciiDithrer::analyzeTile(const Image& image, int tileX, int tileY) {
     return tile;
 }
 
-EdgeDirection AsciiDithrer::getDominantEdgeDirection(const std::vector<EdgeDirection>& directions) {
-    if (directions.empty()) return EdgeDirection::NONE;
-    
-    std::vector<int> counts(4, 0);
-    for (EdgeDirection dir : directions) {
-        if (dir != EdgeDirection::NONE) {
-            counts[static_cast<int>(dir)]++;
-        }
-    }
-    
+EdgeDirection AsciiDithrer::getDominantEdgeDirection(const int* counts) const {
     int maxCount = 0;
     EdgeDirection dominant = EdgeDirection::NONE;
     for (int i = 0; i < 4; ++i) {
@@ -657,8 +484,11 @@ EdgeDirection AsciiDithrer::getDominantEdgeDirection(const std::vector<EdgeDirec
     return dominant;
 }
 
-char AsciiDithrer::selectTileCharacter(const TileInfo& tile) {
-    if (tile.hasSignificantEdges && tile.dominantEdge != EdgeDirection::NONE) {
+char32_t AsciiDithrer::selectTileCharacter(const TileInfo& tile) const {
+    if (glyphMatching_ != GlyphMatching::NONE && tile.hasShape) {
+        // The tile's own shape says more than its edge direction
+        return matchGlyph(tile.shape);
+    } else if (tile.hasSignificantEdges && tile.dominantEdge != EdgeDirection::NONE) {
         // Use edge-aware character selection
         return getDirectionalChar(tile.averageLuminance, tile.dominantEdge);
     } else {
@@ -667,7 +497,47 @@ char AsciiDithrer::selectTileCharacter(const TileInfo& tile) {
     }
 }
 
-Color AsciiDithrer::applyColorTheme(const Color& original, float luminance, float depth) {
+bool AsciiDithrer::tileShape(const Frame& frame, int x0, int y0, int x1, int y1, glyph_match::TileMask& shape) const {
+    // Cell bounds: an even split of the tile, at least one pixel each
+    int cellX[9], cellY[9];
+    for (int i = 0; i <= 8; ++i) {
+        cellX[i] = x0 + (x1 - x0) * i / 8;
+        cellY[i] = y0 + (y1 - y0) * i / 8;
+    }
+    float cells[64];
+    float sum = 0.0f;
+    for (int row = 0; row < 8; ++row) {
+        for (int col = 0; col < 8; ++col) {
+            cells[row * 8 + col] = frame.luminanceTable.mean(cellX[col], cellY[row], std::max(cellX[col + 1], cellX[col] + 1),
+                                                             std::max(cellY[row + 1], cellY[row] + 1));
+            sum += cells[row * 8 + col];
+        }
+    }
+    auto bounds = std::minmax_element(cells, cells + 64);
+    float range = *bounds.second - *bounds.first;
+    if (range < shape_min_contrast) return false;
+
+    // Bright cells are ink, as on the luminance ramps
+    float threshold = sum / 64.0f;
+    shape = {0, 0, 0};
+    for (int i = 0; i < 64; ++i) {
+        float distance = std::fabs(cells[i] - threshold);
+        uint64_t bit = uint64_t(1) << i;
+        if (cells[i] > threshold) shape.bits |= bit;
+        if (distance > 0.25f * range) shape.confident |= bit;
+        if (distance > 0.5f * range) shape.certain |= bit;
+    }
+    return true;
+}
+
+char32_t AsciiDithrer::matchGlyph(const glyph_match::TileMask& shape) const {
+    int index = glyphMatching_ == GlyphMatching::WEIGHTED
+                    ? glyph_match::nearestWeighted(shapes_->masks, shapes_->count, shape)
+                    : glyph_match::nearest(shapes_->masks, shapes_->count, shape.bits);
+    return shapes_->glyphs[index];
+}
+
+Color AsciiDithrer::applyColorTheme(const Color& original, float luminance, float depth) const {
     Color themed = getThemeColor(luminance, depth);
     
     // Apply depth effect
@@ -681,7 +551,7 @@ Color AsciiDithrer::applyColorTheme(const Color& original, float luminance, floa
     return themed;
 }
 
-float AsciiDithrer::calculateDepthEffect(float depth) {
+float AsciiDithrer::calculateDepthEffect(float depth) const {
     switch (depthMode_) {
         case DepthMode::NONE:
             return 1.0f;
@@ -696,54 +566,38 @@ float AsciiDithrer::calculateDepthEffect(float depth) {
     }
 }
 
-void AsciiDithrer::applyBloomEffect(std::vector<Color>& colors, int width, int height) {
+void AsciiDithrer::applyBloomEffect(std::vector<Color>& colors, int width, int height) const {
     if (bloomIntensity_ <= 0.0f) return;
     
-    std::vector<Color> bloomed = colors;
-    
-    for (int y = 1; y < height - 1; ++y) {
-        for (int x = 1; x < width - 1; ++x) {
-            int index = y * width + x;
-            Color& current = colors[index];
-            
-            // Simple bloom: average with bright neighbors
-            Color bloom(0, 0, 0);
-            int brightNeighbors = 0;
-            
-            for (int dy = -1; dy <= 1; ++dy) {
-                for (int dx = -1; dx <= 1; ++dx) {
-                    if (dx == 0 && dy == 0) continue;
-                    
-                    int nx = x + dx;
-                    int ny = y + dy;
-                    if (nx >= 0 && nx < width && ny >= 0 && ny < height) {
-                        Color neighbor = bloomed[ny * width + nx];
-                        float neighborLuminance = getBrightness(neighbor);
-                        
-                        if (neighborLuminance > 0.7f) { // Bright threshold
-                            bloom.r += neighbor.r;
-                            bloom.g += neighbor.g;
-                            bloom.b += neighbor.b;
-                            brightNeighbors++;
-                        }
-                    }
-                }
-            }
-            
-            if (brightNeighbors > 0) {
-                bloom.r /= brightNeighbors;
-                bloom.g /= brightNeighbors;
-                bloom.b /= brightNeighbors;
-                
-                current.r = std::min(255, int(current.r + bloom.r * bloomIntensity_));
-                current.g = std::min(255, int(current.g + bloom.g * bloomIntensity_));
-                current.b = std::min(255, int(current.b + bloom.b * bloomIntensity_));
-            }
+    // Bright pass: the channels of every pixel above the bloom threshold, zero elsewhere
+    size_t count = static_cast<size_t>(width) * height;
+    std::vector<float> glow[3] = {std::vector<float>(count), std::vector<float>(count), std::vector<float>(count)};
+    thread_pool::parallelFor(0, height, 0, [&](int first, int last) {
+        for (size_t i = static_cast<size_t>(first) * width; i < static_cast<size_t>(last) * width; ++i) {
+            bool bright = getBrightness(colors[i]) > 0.7f; // Bright threshold
+            glow[0][i] = bright ? colors[i].r : 0.0f;
+            glow[1][i] = bright ? colors[i].g : 0.0f;
+            glow[2][i] = bright ? colors[i].b : 0.0f;
         }
-    }
+    });
+    
+    // Spread it out and add it back on top
+    std::vector<float> blurred(count);
+    for (std::vector<float>& channel : glow) {
+        gaussian_blur::blur(channel.data(), blurred.data(), width, height, bloomSigma_);
+        channel.swap(blurred);
+    }
+    thread_pool::parallelFor(0, height, 0, [&](int first, int last) {
+        for (size_t i = static_cast<size_t>(first) * width; i < static_cast<size_t>(last) * width; ++i) {
+            Color& current = colors[i];
+            current.r = std::min(1.0f, current.r + glow[0][i] * bloomIntensity_);
+            current.g = std::min(1.0f, current.g + glow[1][i] * bloomIntensity_);
+            current.b = std::min(1.0f, current.b + glow[2][i] * bloomIntensity_);
+        }
+    });
 }
 
-void AsciiDithrer::applyColorBurnEffect(std::vector<Color>& colors) {
+void AsciiDithrer::applyColorBurnEffect(std::vector<Color>& colors) const {
     if (colorBurn_ <= 0.0f) return;
     
     for (Color& color : colors) {
@@ -756,7 +610,7 @@ void AsciiDithrer::applyColorBurnEffect(std::vector<Color>& colors) {
     }
 }
 
-void AsciiDithrer::applyToneMapping(std::vector<Color>& colors) {
+void AsciiDithrer::applyToneMapping(std::vector<Color>& colors) const {
     if (toneMapping_ <= 0.0f) return;
     
     for (Color& color : colors) {
@@ -771,7 +625,7 @@ void AsciiDithrer::applyToneMapping(std::vector<Color>& colors) {
     }
 }
 
-void AsciiDithrer::applyLowContrastEffect(std::vector<Color>& colors) {
+void AsciiDithrer::applyLowContrastEffect(std::vector<Color>& colors) const {
     if (!lowContrast_) return;
     
     for (Color& color : colors) {
@@ -782,7 +636,7 @@ void AsciiDithrer::applyLowContrastEffect(std::vector<Color>& colors) {
     }
 }
 
-Color AsciiDithrer::getThemeColor(float luminance, float depth) {
+Color AsciiDithrer::getThemeColor(float luminance, float depth) const {
     switch (colorTheme_) {
         case ColorTheme::MONOCHROME:
             return Color(luminance, luminance, luminance);
@@ -821,37 +675,13 @@ Color AsciiDithrer::getThemeColor(float luminance, float depth) {
     }
 }
 
-// Simple edge pixel detection using Sobel magnitude threshold
-bool AsciiDithrer::isEdgePixel(const Image& image, int x, int y) {
-    // Use Sobel filter for edge detection
-    int w = image.getWidth();
-    int h = image.getHeight();
-    if (x <= 0 || y <= 0 || x >= w - 1 || y >= h - 1) return false;
-    float gx = 0, gy = 0;
-    float kernelX[3][3] = {{-1,0,1},{-2,0,2},{-1,0,1}};
-    float kernelY[3][3] = {{-1,-2,-1},{0,0,0},{1,2,1}};
-    for (int ky = -1; ky <= 1; ++ky) {
-        for (int kx = -1; kx <= 1; ++kx) {
-            float lum = getBrightness(image.getPixel(x + kx, y + ky));
-            gx += kernelX[ky+1][kx+1] * lum;
-            gy += kernelY[ky+1][kx+1] * lum;
-        }
-    }
-    float mag = sqrt(gx*gx + gy*gy) / 1020.0f; // Normalize
-    return mag > edgeThreshold_;
-}
-
 // Simple brightness to ASCII char mapping
-char AsciiDithrer::brightnessToChar(float brightness, bool isEdge) {
-    const char* ramp = charMap_.empty() ? luminance_chars : charMap_.c_str();
-    int levels = strlen(ramp);
-    int idx = clampi(int((brightness / 255.0f) * (levels - 1)), 0, levels - 1);
-    if (isEdge && levels > 2) idx = levels - 1;
-    return ramp[idx];
+char32_t AsciiDithrer::brightnessToChar(float brightness, bool isEdge) const {
+    return ramp_->glyphs[isEdge ? 255 : glyph_ramps::level(brightness)];
 }
 
 // Directional edge character selection
-char AsciiDithrer::getDirectionalChar(float brightness, EdgeDirection direction) {
+char32_t AsciiDithrer::getDirectionalChar(float brightness, EdgeDirection direction) const {
     switch (direction) {
         case EdgeDirection::VERTICAL: return '|';
         case EdgeDirection::HORIZONTAL: return '-';
@@ -861,52 +691,42 @@ char AsciiDithrer::getDirectionalChar(float brightness, EdgeDirection direction)
     }
 }
 
-// Simple Sobel magnitude as edge strength
-float AsciiDithrer::calculateEdgeStrength(const Image& image, int x, int y) {
-    int w = image.getWidth();
-    int h = image.getHeight();
-    if (x <= 0 || y <= 0 || x >= w - 1 || y >= h - 1) return 0.0f;
-    float gx = 0, gy = 0;
-    float kernelX[3][3] = {{-1,0,1},{-2,0,2},{-1,0,1}};
-    float kernelY[3][3] = {{-1,-2,-1},{0,0,0},{1,2,1}};
-    for (int ky = -1; ky <= 1; ++ky) {
-        for (int kx = -1; kx <= 1; ++kx) {
-            float lum = getBrightness(image.getPixel(x + kx, y + ky));
-            gx += kernelX[ky+1][kx+1] * lum;
-            gy += kernelY[ky+1][kx+1] * lum;
-        }
-    }
-    return sqrt(gx*gx + gy*gy) / 1020.0f;
+bool AsciiDithrer::saveAsTextAdvanced(const Image& inputImage, const std::string& filename) const {
+    std::string text;
+    return renderAsTextAdvanced(inputImage, text) && writeText(filename, text);
 }
 
-bool AsciiDithrer::saveAsTextAdvanced(const Image& inputImage, const std::string& filename) {
+bool AsciiDithrer::renderAsTextAdvanced(const Image& inputImage, std::string& text) const {
     int width = inputImage.getWidth();
     int height = inputImage.getHeight();
     int tilesX = width / tileSize_;
     int tilesY = height / tileSize_;
     if (tilesX < 1 || tilesY < 1) return false;
     
-    std::ofstream file(filename);
-    if (!file.is_open()) return false;
-    
     // Use advanced tile analysis
-    processTiles(inputImage);
+    Frame frame;
+    processTiles(inputImage, frame);
+    std::vector<char32_t> glyphs = selectTileCharacters(frame);
     
+    // Room for three UTF-8 bytes per tile, cut down to what was written
+    text.resize((static_cast<size_t>(tilesX) * 3 + 1) * tilesY);
+    char* out = &text[0];
     for (int ty = 0; ty < tilesY; ++ty) {
         for (int tx = 0; tx < tilesX; ++tx) {
-            int tileIndex = ty * tilesX + tx;
-            TileInfo tile = tileBuffer_[tileIndex];
-            char asciiChar = selectTileCharacter(tile);
-            if (asciiChar == 0) asciiChar = selectFont8x8Char(applyImageProcessing(tile.averageLuminance));
-            file << asciiChar;
+            out = encodeUtf8(glyphs[ty * tilesX + tx], out);
         }
-        file << '\n';
+        *out++ = '\n';
     }
-    file.close();
+    text.resize(out - text.data());
     return true;
 }
 
-bool AsciiDithrer::saveAsTextSimplified(const Image& inputImage, const std::string& filename) {
+bool AsciiDithrer::saveAsTextSimplified(const Image& inputImage, const std::string& filename) const {
+    std::string text;
+    return renderAsTextSimplified(inputImage, text) && writeText(filename, text);
+}
+
+bool AsciiDithrer::renderAsTextSimplified(const Image& inputImage, std::string& text) const {
     int width = inputImage.getWidth();
     int height = inputImage.getHeight();
     int tileSize = 8;
@@ -922,12 +742,14 @@ bool AsciiDithrer::saveAsTextSimplified(const Image& inputImage, const std::stri
     std::vector<float> blurredBuffer(width * height);
     
     // Convert to luminance buffer
-    for (int y = 0; y < height; ++y) {
-        for (int x = 0; x < width; ++x) {
-            Color pixel = inputImage.getPixel(x, y);
-            tempBuffer[y * width + x] = getBrightness(pixel);
+    thread_pool::parallelFor(0, height, 0, [&](int first, int last) {
+        for (int y = first; y < last; ++y) {
+            for (int x = 0; x < width; ++x) {
+                Color pixel = inputImage.getPixel(x, y);
+                tempBuffer[y * width + x] = getBrightness(pixel);
+            }
         }
-    }
+    });
     
     // Apply Gaussian blur (sigma = 2.0)
     float sigma = 2.0f;
@@ -946,95 +768,60 @@ bool AsciiDithrer::saveAsTextSimplified(const Image& inputImage, const std::stri
         kernel[i] /= sum;
     }
     
-    // Horizontal blur
-    for (int y = 0; y < height; ++y) {
-        for (int x = 0; x < width; ++x) {
-            float sum = 0.0f;
-            for (int k = 0; k < kernelSize; ++k) {
-                int nx = x + k - kernelSize/2;
-                nx = std::max(0, std::min(nx, width - 1));
-                sum += tempBuffer[y * width + nx] * kernel[k];
-            }
-            blurredBuffer[y * width + x] = sum;
-        }
-    }
-    
-    // Vertical blur
-    for (int y = 0; y < height; ++y) {
-        for (int x = 0; x < width; ++x) {
-            float sum = 0.0f;
-            for (int k = 0; k < kernelSize; ++k) {
-                int ny = y + k - kernelSize/2;
-                ny = std::max(0, std::min(ny, height - 1));
-                sum += blurredBuffer[ny * width + x] * kernel[k];
-            }
-            tempBuffer[y * width + x] = sum;
-        }
-    }
+    // Horizontal and vertical passes
+    gaussian_blur::convolve(tempBuffer.data(), blurredBuffer.data(), width, height, kernel.data(), kernelSize / 2);
     
     // Character sets
     const char* luminanceChars = ". : c o P 0 ? @";
     const char* boundaryChars = "\\ | / _ - =";
     
-    std::ofstream file(filename);
-    if (!file.is_open()) return false;
-    
-    for (int ty = 0; ty < tilesY; ++ty) {
-        for (int tx = 0; tx < tilesX; ++tx) {
-            // Calculate average brightness for this tile
-            float totalBrightness = 0.0f;
-            int pixelCount = 0;
+    SummedAreaTable blurredTable;
+    blurredTable.build(blurredBuffer.data(), width, height);
+    
+    // A character per tile and a newline per row, so each row has its own place in the text
+    size_t lineLength = static_cast<size_t>(tilesX) + 1;
+    text.assign(lineLength * tilesY, '\n');
+    thread_pool::parallelFor(0, tilesY, 0, [&](int first, int last) {
+        for (int ty = first; ty < last; ++ty) {
+            for (int tx = 0; tx < tilesX; ++tx) {
+                // Calculate average brightness for this tile
+                float avgBrightness = blurredTable.mean(tx * tileSize, ty * tileSize, (tx + 1) * tileSize, (ty + 1) * tileSize);
             
-            for (int dy = 0; dy < tileSize; ++dy) {
-                for (int dx = 0; dx < tileSize; ++dx) {
-                    int x = tx * tileSize + dx;
-                    int y = ty * tileSize + dy;
-                    if (x < width && y < height) {
-                        totalBrightness += tempBuffer[y * width + x];
-                        pixelCount++;
+                // Check if this tile has significant edges (boundaries)
+                bool hasBoundary = false;
+                float maxGradient = 0.0f;
+            
+                for (int dy = 0; dy < tileSize; ++dy) {
+                    for (int dx = 0; dx < tileSize; ++dx) {
+                        int x = tx * tileSize + dx;
+                        int y = ty * tileSize + dy;
+                        if (x > 0 && x < width - 1 && y > 0 && y < height - 1) {
+                            float gx = blurredBuffer[y * width + (x + 1)] - blurredBuffer[y * width + (x - 1)];
+                            float gy = blurredBuffer[(y + 1) * width + x] - blurredBuffer[(y - 1) * width + x];
+                            float gradient = sqrt(gx*gx + gy*gy);
+                            maxGradient = std::max(maxGradient, gradient);
+                        }
                     }
                 }
-            }
-            
-            float avgBrightness = totalBrightness / pixelCount;
             
-            // Check if this tile has significant edges (boundaries)
-            bool hasBoundary = false;
-            float maxGradient = 0.0f;
+                hasBoundary = maxGradient > 30.0f; // Threshold for boundary detection
             
-            for (int dy = 0; dy < tileSize; ++dy) {
-                for (int dx = 0; dx < tileSize; ++dx) {
-                    int x = tx * tileSize + dx;
-                    int y = ty * tileSize + dy;
-                    if (x > 0 && x < width - 1 && y > 0 && y < height - 1) {
-                        float gx = tempBuffer[y * width + (x + 1)] - tempBuffer[y * width + (x - 1)];
-                        float gy = tempBuffer[(y + 1) * width + x] - tempBuffer[(y - 1) * width + x];
-                        float gradient = sqrt(gx*gx + gy*gy);
-                        maxGradient = std::max(maxGradient, gradient);
-                    }
+                char asciiChar;
+                if (hasBoundary) {
+                    // Use boundary characters based on gradient direction
+                    int boundaryIndex = (int)(maxGradient / 50.0f) % 6; // 6 boundary characters
+                    asciiChar = boundaryChars[boundaryIndex * 2]; // Skip spaces in string
+                } else {
+                    // Use luminance characters
+                    int luminanceLevels = 8; // 8 luminance characters
+                    int index = (int)((avgBrightness / 255.0f) * (luminanceLevels - 1));
+                    index = std::max(0, std::min(index, luminanceLevels - 1));
+                    asciiChar = luminanceChars[index * 2]; // Skip spaces in string
                 }
-            }
             
-            hasBoundary = maxGradient > 30.0f; // Threshold for boundary detection
-            
-            char asciiChar;
-            if (hasBoundary) {
-                // Use boundary characters based on gradient direction
-                int boundaryIndex = (int)(maxGradient / 50.0f) % 6; // 6 boundary characters
-                asciiChar = boundaryChars[boundaryIndex * 2]; // Skip spaces in string
-            } else {
-                // Use luminance characters
-                int luminanceLevels = 8; // 8 luminance characters
-                int index = (int)((avgBrightness / 255.0f) * (luminanceLevels - 1));
-                index = std::max(0, std::min(index, luminanceLevels - 1));
-                asciiChar = luminanceChars[index * 2]; // Skip spaces in string
+                text[ty * lineLength + tx] = asciiChar;
             }
-            
-            file << asciiChar;
         }
-        file << '\n';
-    }
-    
-    file.close();
+    });
     return true;
 } 
\ No newline at end of file
@@ -0,0 +1,60 @@
+//
+// Created by Dhruva Sharma on 18/2/25.
+//
+
+#include "headers/bayer_tables.h"
+
+namespace bayer_tables {
+
+namespace {
+
+template <int Order>
+struct Table {
+    static constexpr int size = 1 << Order;
+    static constexpr int width8 = size < 64 ? 64 : size;
+
+    alignas(64) float thresholds[size * size];
+    alignas(64) unsigned char levels[size * width8];
+
+    constexpr Table() : thresholds(), levels() {
+        constexpr float cells = static_cast<float>(size * size);
+        for (int y = 0; y < size; ++y) {
+            for (int x = 0; x < size; ++x) {
+                thresholds[y * size + x] = (rank(Order, x, y) + 0.5f) / cells;
+            }
+            for (int x = 0; x < width8; ++x) {
+                levels[y * width8 + x] = static_cast<unsigned char>(thresholds[y * size + (x & (size - 1))] * 255.0f);
+            }
+        }
+    }
+
+    View view() const { return {size, width8, thresholds, levels}; }
+};
+
+constexpr Table<1> kTable1;
+constexpr Table<2> kTable2;
+constexpr Table<3> kTable3;
+constexpr Table<4> kTable4;
+constexpr Table<5> kTable5;
+constexpr Table<6> kTable6;
+constexpr Table<7> kTable7;
+constexpr Table<8> kTable8;
+
+static_assert(kTable1.thresholds[0] == 0.125f && kTable1.thresholds[3] == 0.875f, "2x2 Bayer layout");
+
+}
+
+View view(int order) {
+    switch (order <= kMinOrder ? kMinOrder : (order >= kMaxOrder ? kMaxOrder : order)) {
+        case 1: return kTable1.view();
+        case 2: return kTable2.view();
+        case 3: return kTable3.view();
+        case 4: return kTable4.view();
+        case 5: return kTable5.view();
+        case 6: return kTable6.view();
+        case 7: return kTable7.view();
+        default: return kTable8.view();
+    }
+}
+
+}
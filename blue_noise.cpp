@@ -0,0 +1,263 @@
+//
+// Created by Dhruva Sharma on 18/2/25.
+//
+
+#include "headers/blue_noise.h"
+#include "headers/thread_pool.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <numeric>
+#include <random>
+#include <string>
+#include <thread>
+
+namespace blue_noise {
+
+namespace {
+
+constexpr float kSigma = 1.5f;
+constexpr int kRadius = 5;
+constexpr char kMagic[4] = {'D', 'B', 'B', 'N'};
+constexpr uint32_t kVersion = 1;
+
+// Gaussian-filtered density of the minority pixels on a torus. Toggling a pixel updates the
+// energy in a (2 * kRadius + 1)^2 window; the per-row extremes are refreshed for the touched
+// rows only, so finding the tightest cluster or largest void is a scan over rows.
+class EnergyField {
+  public:
+    EnergyField(int size, std::vector<unsigned char> bits) : size_(size), bits_(std::move(bits)) {
+      for (int dy = -kRadius; dy <= kRadius; ++dy) {
+        for (int dx = -kRadius; dx <= kRadius; ++dx) {
+          kernel_.push_back(std::exp(-(dx * dx + dy * dy) / (2.0f * kSigma * kSigma)));
+        }
+      }
+      energy_.assign(bits_.size(), 0.0f);
+      rowCluster_.assign(size_, -1);
+      rowVoid_.assign(size_, -1);
+      Build();
+    }
+
+    int ones() const { return static_cast<int>(std::count(bits_.begin(), bits_.end(), 1)); }
+
+    void set(int index, bool on) {
+      bits_[index] = on ? 1 : 0;
+      float sign = on ? 1.0f : -1.0f;
+      int x = index % size_;
+      int y = index / size_;
+      const float* weight = kernel_.data();
+      for (int dy = -kRadius; dy <= kRadius; ++dy) {
+        float* row = energy_.data() + static_cast<size_t>(Wrap(y + dy)) * size_;
+        for (int dx = -kRadius; dx <= kRadius; ++dx) row[Wrap(x + dx)] += sign * *weight++;
+      }
+      for (int dy = -kRadius; dy <= kRadius; ++dy) RefreshRow(Wrap(y + dy));
+    }
+
+    // Minority pixel with the highest energy
+    int tightestCluster() const {
+      int best = -1;
+      for (int candidate : rowCluster_) {
+        if (candidate >= 0 && (best < 0 || energy_[candidate] > energy_[best])) best = candidate;
+      }
+      return best;
+    }
+
+    // Empty pixel with the lowest energy
+    int largestVoid() const {
+      int best = -1;
+      for (int candidate : rowVoid_) {
+        if (candidate >= 0 && (best < 0 || energy_[candidate] < energy_[best])) best = candidate;
+      }
+      return best;
+    }
+
+  private:
+    int size_;
+    std::vector<unsigned char> bits_;
+    std::vector<float> energy_;
+    std::vector<float> kernel_;
+    std::vector<int> rowCluster_;
+    std::vector<int> rowVoid_;
+
+    int Wrap(int v) const { return v & (size_ - 1); }
+
+    // Full convolution, split into row bands across the thread pool
+    void Build() {
+      thread_pool::parallelFor(0, size_, 0, [&](int first, int last) {
+        for (int y = first; y < last; ++y) {
+          for (int x = 0; x < size_; ++x) {
+            float sum = 0.0f;
+            const float* weight = kernel_.data();
+            for (int dy = -kRadius; dy <= kRadius; ++dy) {
+              const unsigned char* row = bits_.data() + static_cast<size_t>(Wrap(y + dy)) * size_;
+              for (int dx = -kRadius; dx <= kRadius; ++dx) sum += row[Wrap(x + dx)] * *weight++;
+            }
+            energy_[static_cast<size_t>(y) * size_ + x] = sum;
+          }
+          RefreshRow(y);
+        }
+      });
+    }
+
+    void RefreshRow(int y) {
+      int cluster = -1, empty = -1;
+      int start = y * size_;
+      for (int i = start; i < start + size_; ++i) {
+        if (bits_[i]) {
+          if (cluster < 0 || energy_[i] > energy_[cluster]) cluster = i;
+        } else if (empty < 0 || energy_[i] < energy_[empty]) {
+          empty = i;
+        }
+      }
+      rowCluster_[y] = cluster;
+      rowVoid_[y] = empty;
+    }
+};
+
+std::filesystem::path CacheDirectory() {
+  if (const char* dir = std::getenv("DITHERBOY_CACHE_DIR")) return dir;
+  if (const char* xdg = std::getenv("XDG_CACHE_HOME")) return std::filesystem::path(xdg) / "ditherboy";
+  if (const char* home = std::getenv("HOME")) return std::filesystem::path(home) / ".cache" / "ditherboy";
+  std::error_code ec;
+  return std::filesystem::temp_directory_path(ec) / "ditherboy";
+}
+
+std::filesystem::path CacheFile(int size) {
+  return CacheDirectory() / ("bluenoise_" + std::to_string(size) + ".bin");
+}
+
+// The cache is a plain host-endian dump: magic, version, size, then one rank per cell
+bool LoadRanks(int size, std::vector<uint16_t>& ranks) {
+  std::ifstream file(CacheFile(size), std::ios::binary);
+  if (!file) return false;
+  char magic[4];
+  uint32_t version = 0, storedSize = 0;
+  file.read(magic, sizeof(magic));
+  file.read(reinterpret_cast<char*>(&version), sizeof(version));
+  file.read(reinterpret_cast<char*>(&storedSize), sizeof(storedSize));
+  if (!file || std::memcmp(magic, kMagic, sizeof(magic)) != 0 || version != kVersion ||
+      storedSize != static_cast<uint32_t>(size)) {
+    return false;
+  }
+  size_t count = static_cast<size_t>(size) * size;
+  ranks.resize(count);
+  file.read(reinterpret_cast<char*>(ranks.data()), count * sizeof(uint16_t));
+  if (!file) return false;
+
+  // Reject truncated or corrupted files: the ranks must be a permutation
+  std::vector<unsigned char> seen(count, 0);
+  for (uint16_t rank : ranks) {
+    if (rank >= count || seen[rank]) return false;
+    seen[rank] = 1;
+  }
+  return true;
+}
+
+// Best effort: a read-only or missing cache directory just means regenerating next run
+void SaveRanks(int size, const std::vector<uint16_t>& ranks) {
+  std::error_code ec;
+  std::filesystem::create_directories(CacheDirectory(), ec);
+  std::filesystem::path target = CacheFile(size);
+  std::filesystem::path temporary = target;
+  temporary += ".tmp" + std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id()));
+  {
+    std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+    if (!file) return;
+    uint32_t version = kVersion, storedSize = static_cast<uint32_t>(size);
+    file.write(kMagic, sizeof(kMagic));
+    file.write(reinterpret_cast<const char*>(&version), sizeof(version));
+    file.write(reinterpret_cast<const char*>(&storedSize), sizeof(storedSize));
+    file.write(reinterpret_cast<const char*>(ranks.data()), ranks.size() * sizeof(uint16_t));
+    if (!file) {
+      file.close();
+      std::filesystem::remove(temporary, ec);
+      return;
+    }
+  }
+  // Rename so concurrent readers never see a half-written mask
+  std::filesystem::rename(temporary, target, ec);
+  if (ec) std::filesystem::remove(temporary, ec);
+}
+
+}
+
+int supportedSize(int size) {
+  if (size <= 96) return 64;
+  if (size <= 192) return 128;
+  return 256;
+}
+
+std::vector<uint16_t> generateRanks(int size) {
+  size = supportedSize(size);
+  int count = size * size;
+
+  // Initial pattern: a fixed-seed random 10% of the cells, so every run yields the same mask
+  std::vector<int> order(count);
+  std::iota(order.begin(), order.end(), 0);
+  std::mt19937 rng(static_cast<unsigned>(size));
+  std::shuffle(order.begin(), order.end(), rng);
+  std::vector<unsigned char> bits(count, 0);
+  for (int i = 0; i < count / 10; ++i) bits[order[i]] = 1;
+
+  // Relax into the prototype: move the tightest cluster into the largest void until stable
+  EnergyField prototype(size, std::move(bits));
+  for (int iteration = 0; iteration < count; ++iteration) {
+    int cluster = prototype.tightestCluster();
+    prototype.set(cluster, false);
+    int empty = prototype.largestVoid();
+    prototype.set(empty, true);
+    if (empty == cluster) break;
+  }
+
+  std::vector<uint16_t> ranks(count, 0);
+  int ones = prototype.ones();
+
+  // Phase 1 (removing clusters from the prototype) and phases 2-3 (filling voids) start from
+  // the same pattern and write disjoint rank ranges, so they run concurrently.
+  EnergyField removing = prototype;
+  thread_pool::TaskGroup phase1;
+  phase1.run([&removing, &ranks, ones] {
+    for (int rank = ones - 1; rank >= 0; --rank) {
+      int cluster = removing.tightestCluster();
+      removing.set(cluster, false);
+      ranks[cluster] = static_cast<uint16_t>(rank);
+    }
+  });
+  // Past half coverage the minority flips, but with a fixed kernel "tightest cluster of
+  // zeros" is the same pixel as "largest void of ones", so one loop covers both phases.
+  for (int rank = ones; rank < count; ++rank) {
+    int empty = prototype.largestVoid();
+    prototype.set(empty, true);
+    ranks[empty] = static_cast<uint16_t>(rank);
+  }
+  phase1.wait();
+  return ranks;
+}
+
+const std::vector<float>& thresholdMap(int size) {
+  static std::mutex mutex;
+  static std::map<int, std::vector<float>> maps;
+
+  size = supportedSize(size);
+  std::lock_guard<std::mutex> lock(mutex);
+  auto found = maps.find(size);
+  if (found != maps.end()) return found->second;
+
+  std::vector<uint16_t> ranks;
+  if (!LoadRanks(size, ranks)) {
+    ranks = generateRanks(size);
+    SaveRanks(size, ranks);
+  }
+  float cells = static_cast<float>(ranks.size());
+  std::vector<float>& thresholds = maps[size];
+  thresholds.resize(ranks.size());
+  for (size_t i = 0; i < ranks.size(); ++i) thresholds[i] = (ranks[i] + 0.5f) / cells;
+  return thresholds;
+}
+
+}
@@ -0,0 +1,64 @@
+//
+// Created by Dhruva Sharma on 18/2/25.
+//
+
+#include "headers/blue_noise_dithrer.h"
+#include "headers/blue_noise.h"
+#include "headers/gray_pipeline.h"
+#include "headers/channel_levels.h"
+#include "headers/thread_pool.h"
+
+BlueNoiseDithrer::BlueNoiseDithrer(int size)
+    : size_(blue_noise::supportedSize(size)), thresholds_(&blue_noise::thresholdMap(size_)) {
+  tile_ = ordered_kernels::tileThresholds(thresholds_->data(), size_);
+}
+
+void BlueNoiseDithrer::applyDither(const Image& inputImage, Image& outputImage, const Pallete& pallete) {
+  int width = inputImage.getWidth();
+  int height = inputImage.getHeight();
+  int mask = size_ - 1;
+
+  if (gray_pipeline::canUse(pallete)) {
+    std::vector<unsigned char> gray = gray_pipeline::decodeGray8(inputImage);
+    gray_pipeline::GrayLevels levels(pallete);
+    std::vector<unsigned char> indices(gray.size());
+    ordered_kernels::UniformRamp ramp;
+    if (ordered_kernels::uniformRamp(levels, ramp)) {
+      thread_pool::parallelFor(0, height, 0, [&](int first, int last) {
+        for (int y = first; y < last; ++y) {
+          size_t offset = static_cast<size_t>(y) * width;
+          ordered_kernels::ditherRow(gray.data() + offset, tile_.row(y), tile_.width, indices.data() + offset, width, ramp);
+        }
+      });
+      gray_pipeline::emitIndices(indices, width, height, pallete, outputImage);
+      return;
+    }
+    thread_pool::parallelFor(0, height, 0, [&](int first, int last) {
+      for (int y = first; y < last; ++y) {
+        const unsigned char* in = gray.data() + static_cast<size_t>(y) * width;
+        unsigned char* out = indices.data() + static_cast<size_t>(y) * width;
+        const float* thresholds = thresholds_->data() + static_cast<size_t>(y & mask) * size_;
+        for (int x = 0; x < width; ++x) {
+          const gray_pipeline::GrayLevels::Step& step = levels.step(in[x]);
+          out[x] = step.fraction > thresholds[x & mask] ? step.upper : step.lower;
+        }
+      }
+    });
+    gray_pipeline::emitIndices(indices, width, height, pallete, outputImage);
+    return;
+  }
+
+  outputImage = inputImage;
+  ChannelLevels levels(pallete);
+  thread_pool::parallelFor(0, height, 0, [&](int first, int last) {
+    for (int y = first; y < last; ++y) {
+      const Color* in = inputImage.getRow(y);
+      Color* out = outputImage.getRow(y);
+      const float* thresholds = thresholds_->data() + static_cast<size_t>(y & mask) * size_;
+      for (int x = 0; x < width; ++x) {
+        out[x] = levels.spread(in[x], thresholds[x & mask]);
+      }
+      pallete.GetClosestColors(out, out, width);
+    }
+  });
+}
@@ -0,0 +1,40 @@
+//
+// Created by Dhruva Sharma on 18/2/25.
+//
+
+#include "headers/channel_levels.h"
+#include <algorithm>
+
+ChannelLevels::ChannelLevels(const Pallete& pallete) {
+  for (int i = 0; i < pallete.getSize(); ++i) {
+    const Color& color = pallete.getColor(i);
+    levels_[0].push_back(color.r);
+    levels_[1].push_back(color.g);
+    levels_[2].push_back(color.b);
+  }
+  for (auto& levels : levels_) {
+    std::sort(levels.begin(), levels.end());
+    levels.erase(std::unique(levels.begin(), levels.end()), levels.end());
+  }
+}
+
+float ChannelLevels::Spread(int channel, float value, float threshold) const {
+  const std::vector<float>& levels = levels_[channel];
+  auto upper = std::upper_bound(levels.begin(), levels.end(), value);
+  // Outside the palette range there is no gap to dither across
+  if (upper == levels.begin() || upper == levels.end()) return value;
+  float high = *upper;
+  float low = *(upper - 1);
+  float gap = high - low;
+  // Shifted so the gap midpoint is crossed exactly when (value - low) / gap > threshold,
+  // and kept inside the gap so a neighbouring level never wins
+  float position = (value - low) / gap + 0.5f - threshold;
+  return low + std::max(0.0f, std::min(1.0f, position)) * gap;
+}
+
+float ChannelLevels::Gap(int channel, float value) const {
+  const std::vector<float>& levels = levels_[channel];
+  auto upper = std::upper_bound(levels.begin(), levels.end(), value);
+  if (upper == levels.begin() || upper == levels.end()) return 0.0f;
+  return *upper - *(upper - 1);
+}
@@ -0,0 +1,80 @@
+//
+// Created by Dhruva Sharma on 18/2/25.
+//
+
+#include "headers/cpu_dispatch.h"
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+namespace cpu_dispatch {
+
+namespace {
+
+Isa Detect() {
+#ifdef CPU_DISPATCH_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")) return Isa::AVX512;
+    if (__builtin_cpu_supports("avx2")) return Isa::AVX2;
+    if (__builtin_cpu_supports("sse4.2")) return Isa::SSE42;
+#endif
+    return Isa::SCALAR;
+}
+
+// False for names that are not an instruction set we build for
+bool ParseIsa(std::string name, Isa& isa) {
+    std::transform(name.begin(), name.end(), name.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    name.erase(std::remove_if(name.begin(), name.end(), [](char c) { return c == '.' || c == '_' || c == '-'; }),
+               name.end());
+    if (name == "scalar" || name == "none") isa = Isa::SCALAR;
+    else if (name == "sse42" || name == "sse") isa = Isa::SSE42;
+    else if (name == "avx2") isa = Isa::AVX2;
+    else if (name == "avx512") isa = Isa::AVX512;
+    else return false;
+    return true;
+}
+
+Isa SelectActive() {
+    Isa detected = detectedIsa();
+    const char* forced = std::getenv("DITHERBOY_FORCE_ISA");
+    if (!forced || !*forced) return detected;
+
+    Isa requested;
+    if (!ParseIsa(forced, requested)) {
+        std::cerr << "DITHERBOY_FORCE_ISA: unknown instruction set '" << forced << "', using "
+                  << isaName(detected) << std::endl;
+        return detected;
+    }
+    if (static_cast<int>(requested) > static_cast<int>(detected)) {
+        std::cerr << "DITHERBOY_FORCE_ISA: " << isaName(requested) << " is not supported by this CPU, using "
+                  << isaName(detected) << std::endl;
+        return detected;
+    }
+    return requested;
+}
+
+}
+
+Isa detectedIsa() {
+    static const Isa isa = Detect();
+    return isa;
+}
+
+Isa activeIsa() {
+    static const Isa isa = SelectActive();
+    return isa;
+}
+
+const char* isaName(Isa isa) {
+    switch (isa) {
+        case Isa::SSE42: return "sse4.2";
+        case Isa::AVX2: return "avx2";
+        case Isa::AVX512: return "avx512";
+        default: return "scalar";
+    }
+}
+
+}
@@ -0,0 +1,223 @@
+//
+// Created by Dhruva Sharma on 18/2/25.
+//
+
+#include "headers/error_diffusion_dithrer.h"
+#include "headers/color_simd.h"
+#include "headers/gray_pipeline.h"
+#include "headers/thread_pool.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <thread>
+
+// Rows diffused concurrently. Row y trails row y - 1 by enough pixels that every error it reads
+// or adds to has already been written by the rows above, in the same order as a serial pass,
+// so the output does not depend on the number of threads.
+struct DiffusionWavefront {
+    DiffusionWavefront(int height, int lanes) : done(height), lanes(lanes) {}
+
+    // Pixels of a row finished so far, counted in the row's scan direction; the row's width once
+    // its ring row has been cleared
+    std::vector<std::atomic<int>> done;
+    std::atomic<int> nextRow{0};
+    int lanes;
+
+    void await(int row, int pixels) const {
+        if (row < 0) return;
+        while (done[row].load(std::memory_order_acquire) < pixels) std::this_thread::yield();
+    }
+    // Waits until row, scanned in direction, has finished every column in [first, last). A row
+    // scanned right to left finishes its columns from width - 1 down.
+    void awaitColumns(int row, int direction, int width, int first, int last) const {
+        first = std::max(first, 0);
+        last = std::min(last, width);
+        if (first < last) await(row, direction > 0 ? last : width - first);
+    }
+    void publish(int row, int pixels) { done[row].store(pixels, std::memory_order_release); }
+};
+
+// Progress is exchanged once per span rather than per pixel
+static const int kWavefrontSpan = 64;
+
+// RGB error is kept as four floats per pixel, alpha always zero, so each pixel is one register
+static const int kErrorChannels = 4;
+
+// Runs row(y) for every row, in order, or from `lanes` tasks that each take the next free row
+static void ForEachRow(int height, DiffusionWavefront* wavefront, const std::function<void(int)>& row) {
+    if (!wavefront) {
+        for (int y = 0; y < height; ++y) row(y);
+        return;
+    }
+    thread_pool::parallelFor(0, wavefront->lanes, 1, [&](int, int) {
+        for (int y = wavefront->nextRow++; y < height; y = wavefront->nextRow++) row(y);
+    });
+}
+
+ErrorDiffusionDithrer::ErrorDiffusionDithrer(std::vector<DiffusionTap> kernel)
+    : kernel_(std::move(kernel)), levelDependent_(false), maxDx_(0), maxDy_(0), serpentine_(false) {
+    for (const auto& tap : kernel_) {
+        maxDx_ = std::max(maxDx_, std::abs(tap.dx));
+        maxDy_ = std::max(maxDy_, tap.dy);
+        weights_.push_back(tap.weight);
+    }
+}
+
+const float* ErrorDiffusionDithrer::KernelWeights(int) const {
+    return weights_.data();
+}
+
+// Adds the weighted quantization error to every tap. Offsets are precomputed per row so the
+// padding around each error row absorbs taps that fall off the left or right edge.
+static void DistributeError(float* pixelError, const std::vector<int>& offsets,
+                            const float* weights, color_simd::Pixel error) {
+    for (size_t i = 0; i < offsets.size(); ++i) {
+        float* target = pixelError + offsets[i];
+        color_simd::store(target, color_simd::load(target) + error * weights[i]);
+    }
+}
+
+static void DistributeErrorGray(float* pixelError, const std::vector<int>& offsets,
+                                const float* weights, float error) {
+    for (size_t i = 0; i < offsets.size(); ++i) {
+        pixelError[offsets[i]] += error * weights[i];
+    }
+}
+
+void ErrorDiffusionDithrer::applyDither(const Image& inputImage, Image& outputImage, const Pallete& pallete) {
+    int width = inputImage.getWidth();
+    int height = inputImage.getHeight();
+
+    // A row can be reused by the ring once every row that might still write to it is done;
+    // with concurrent rows that is `lanes` more rows than the kernel reaches down
+    int lanes = Lanes(height);
+    int ringRows = maxDy_ + 1 + (lanes > 1 ? lanes : 0);
+    std::unique_ptr<DiffusionWavefront> wavefront;
+    if (lanes > 1) wavefront = std::make_unique<DiffusionWavefront>(height, lanes);
+
+    // Achromatic palettes only need one channel of error
+    if (gray_pipeline::canUse(pallete) && width > 0 && height > 0) {
+        std::vector<unsigned char> gray = gray_pipeline::decodeGray8(inputImage);
+        std::vector<unsigned char> indices(gray.size());
+        gray_pipeline::GrayLevels levels(pallete);
+        std::vector<float> errorRows(ringRows * (width + 2 * maxDx_), 0.0f);
+        ForEachRow(height, wavefront.get(), [&](int y) {
+            DiffuseRowGray(gray, indices, levels, errorRows, width, ringRows, y, wavefront.get());
+        });
+        gray_pipeline::emitIndices(indices, width, height, pallete, outputImage);
+        return;
+    }
+
+    // Copy input image to output image (keeps dimensions and alpha)
+    outputImage = inputImage;
+    if (width <= 0 || height <= 0) return;
+
+    // Error rows for the rows in flight and the maxDy_ rows below them, reused as a ring
+    std::vector<float> errorRows(ringRows * (width + 2 * maxDx_) * kErrorChannels, 0.0f);
+    ForEachRow(height, wavefront.get(), [&](int y) {
+        DiffuseRow(inputImage, outputImage, pallete, errorRows, ringRows, y, wavefront.get());
+    });
+}
+
+int ErrorDiffusionDithrer::Lanes(int height) const {
+    if (height < 2) return 1;
+    return std::min(thread_pool::threadCount(), height);
+}
+
+void ErrorDiffusionDithrer::AwaitRowAbove(const DiffusionWavefront& wavefront, int y, int width,
+                                          int start, int end) const {
+    // Pixels start to end of row y, in its scan direction, as columns
+    int first = ScanDirection(y) > 0 ? start : width - end;
+    int last = ScanDirection(y) > 0 ? end : width - start;
+    wavefront.awaitColumns(y - 1, ScanDirection(y - 1), width, first - 2 * maxDx_, last + 2 * maxDx_);
+}
+
+std::vector<int> ErrorDiffusionDithrer::TapOffsets(int y, int stride, int channels, int ringRows) const {
+    // Odd rows are scanned right to left in serpentine mode, which mirrors the kernel.
+    // Taps below the last row land in ring rows that are never read again.
+    int direction = ScanDirection(y);
+    std::vector<int> offsets;
+    offsets.reserve(kernel_.size());
+    for (const auto& tap : kernel_) {
+        int ring = (y + tap.dy) % ringRows;
+        int rowDelta = (ring - y % ringRows) * stride;
+        offsets.push_back(rowDelta + direction * tap.dx * channels);
+    }
+    return offsets;
+}
+
+void ErrorDiffusionDithrer::DiffuseRow(const Image& inputImage, Image& outputImage, const Pallete& pallete,
+                                       std::vector<float>& errorRows, int ringRows, int y,
+                                       DiffusionWavefront* wavefront) const {
+    int width = outputImage.getWidth();
+    int stride = (width + 2 * maxDx_) * kErrorChannels;
+    float* currentRow = errorRows.data() + (y % ringRows) * stride + maxDx_ * kErrorChannels;
+    std::vector<int> offsets = TapOffsets(y, stride, kErrorChannels, ringRows);
+
+    const Color* source = inputImage.getRow(y);
+    Color* target = outputImage.getRow(y);
+    int direction = ScanDirection(y);
+    int x = direction > 0 ? 0 : width - 1;
+    // The ring row y + maxDy_ was last used by row y - 1 - lanes, which has to be cleared by now
+    if (wavefront) wavefront->await(y - 1 - wavefront->lanes, width);
+    for (int start = 0; start < width; start += kWavefrontSpan) {
+        int end = std::min(width, start + kWavefrontSpan);
+        // Taps reach maxDx_ to either side, so row y - 1 must have finished 2 * maxDx_ columns
+        // either side of this span. In serpentine mode it runs the other way, so that is most of it.
+        if (wavefront) AwaitRowAbove(*wavefront, y, width, start, end);
+        for (int i = start; i < end; ++i, x += direction) {
+            float* pixelError = currentRow + x * kErrorChannels;
+
+            // Pixel value plus the error diffused into it so far (alpha unchanged)
+            color_simd::Pixel oldColor = color_simd::load(source[x]) + color_simd::load(pixelError);
+            const Color& newColor = pallete.GetClosestColor(color_simd::toColor(oldColor));
+            target[x] = newColor;
+
+            // Level-dependent kernels are indexed by the input level, not the level with error added
+            const float* weights = weights_.data();
+            if (levelDependent_) {
+                float mean = std::max(0.0f, std::min(1.0f, (source[x].r + source[x].g + source[x].b) / 3.0f));
+                weights = KernelWeights(static_cast<int>(mean * 255.0f + 0.5f));
+            }
+
+            DistributeError(pixelError, offsets, weights, color_simd::rgb(oldColor - color_simd::load(newColor)));
+        }
+        if (wavefront && end < width) wavefront->publish(y, end);
+    }
+
+    // The row is done; clear it (padding included) so the ring can reuse it for row y + ringRows
+    std::fill(currentRow - maxDx_ * kErrorChannels, currentRow - maxDx_ * kErrorChannels + stride, 0.0f);
+    if (wavefront) wavefront->publish(y, width);
+}
+
+void ErrorDiffusionDithrer::DiffuseRowGray(const std::vector<unsigned char>& gray, std::vector<unsigned char>& indices,
+                                           const gray_pipeline::GrayLevels& levels, std::vector<float>& errorRows,
+                                           int width, int ringRows, int y, DiffusionWavefront* wavefront) const {
+    int stride = width + 2 * maxDx_;
+    float* currentRow = errorRows.data() + (y % ringRows) * stride + maxDx_;
+    std::vector<int> offsets = TapOffsets(y, stride, 1, ringRows);
+
+    const unsigned char* source = gray.data() + static_cast<size_t>(y) * width;
+    unsigned char* target = indices.data() + static_cast<size_t>(y) * width;
+    int direction = ScanDirection(y);
+    int x = direction > 0 ? 0 : width - 1;
+    if (wavefront) wavefront->await(y - 1 - wavefront->lanes, width);
+    for (int start = 0; start < width; start += kWavefrontSpan) {
+        int end = std::min(width, start + kWavefrontSpan);
+        if (wavefront) AwaitRowAbove(*wavefront, y, width, start, end);
+        for (int i = start; i < end; ++i, x += direction) {
+            float* pixelError = currentRow + x;
+            float oldValue = source[x] + *pixelError;
+            int index = levels.closestIndex(oldValue);
+            target[x] = static_cast<unsigned char>(index);
+            const float* weights = levelDependent_ ? KernelWeights(source[x]) : weights_.data();
+            DistributeErrorGray(pixelError, offsets, weights, oldValue - levels.level(index));
+        }
+        if (wavefront && end < width) wavefront->publish(y, end);
+    }
+
+    std::fill(currentRow - maxDx_, currentRow - maxDx_ + stride, 0.0f);
+    if (wavefront) wavefront->publish(y, width);
+}
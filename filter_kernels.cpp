@@ -0,0 +1,447 @@
+//
+// Created by Dhruva Sharma on 18/2/25.
+//
+
+#include "headers/filter_kernels.h"
+#include "headers/cpu_dispatch.h"
+#include <algorithm>
+#include <cmath>
+
+namespace filter_kernels {
+
+namespace {
+
+// ---- Scalar ----
+
+void BlurRowScalar(const float* in, float* out, int begin, int end, int width,
+                   const float* weights, int radius, float norm) {
+    for (int x = begin; x < end; ++x) {
+        float sum = 0.0f;
+        for (int k = 0; k <= 2 * radius; ++k) {
+            sum += in[std::max(0, std::min(x - radius + k, width - 1))] * weights[k];
+        }
+        out[x] = sum / norm;
+    }
+}
+
+void BlurColumnsScalar(const float* const* rows, float* out, int begin, int end,
+                       const float* weights, int radius, float norm) {
+    for (int x = begin; x < end; ++x) {
+        float sum = 0.0f;
+        for (int k = 0; k <= 2 * radius; ++k) sum += rows[k][x] * weights[k];
+        out[x] = sum / norm;
+    }
+}
+
+void SobelRowScalar(const float* above, const float* row, const float* below, int begin, int end,
+                    float* gx, float* gy, float* magnitude) {
+    for (int x = begin; x < end; ++x) {
+        float dx = -1 * above[x - 1] + 1 * above[x + 1] +
+                   -2 * row[x - 1] + 2 * row[x + 1] +
+                   -1 * below[x - 1] + 1 * below[x + 1];
+        float dy = -1 * above[x - 1] + -2 * above[x] + -1 * above[x + 1] +
+                   1 * below[x - 1] + 2 * below[x] + 1 * below[x + 1];
+        gx[x] = dx;
+        gy[x] = dy;
+        magnitude[x] = std::sqrt(dx * dx + dy * dy);
+    }
+}
+
+void BlurRowPairScalar(const float* in, float* out1, float* out2, int begin, int end, int width,
+                       const float* weights1, int radius1, const float* weights2, int radius2) {
+    for (int x = begin; x < end; ++x) {
+        float sum1 = 0.0f, sum2 = 0.0f;
+        for (int k = 0; k <= 2 * radius1; ++k) {
+            sum1 += in[std::max(0, std::min(x - radius1 + k, width - 1))] * weights1[k];
+        }
+        for (int k = 0; k <= 2 * radius2; ++k) {
+            sum2 += in[std::max(0, std::min(x - radius2 + k, width - 1))] * weights2[k];
+        }
+        out1[x] = sum1;
+        out2[x] = sum2;
+    }
+}
+
+void DifferenceColumnsScalar(const float* const* rows1, const float* const* rows2, float* out, int begin, int end,
+                             const float* weights1, int radius1, const float* weights2, int radius2, float tau) {
+    for (int x = begin; x < end; ++x) {
+        float sum1 = 0.0f, sum2 = 0.0f;
+        for (int k = 0; k <= 2 * radius1; ++k) sum1 += rows1[k][x] * weights1[k];
+        for (int k = 0; k <= 2 * radius2; ++k) sum2 += rows2[k][x] * weights2[k];
+        out[x] = sum1 - tau * sum2;
+    }
+}
+
+// Columns whose taps all fall inside the row, where the SIMD loops need no clamping
+void Interior(int width, int radius, int& begin, int& end) {
+    begin = std::min(radius, width);
+    end = std::max(begin, width - radius);
+}
+
+#ifdef CPU_DISPATCH_X86
+
+// ---- SSE4.2 ----
+
+__attribute__((target("sse4.2")))
+void BlurRowSse(const float* in, float* out, int width, const float* weights, int radius, float norm) {
+    int begin, end;
+    Interior(width, radius, begin, end);
+    BlurRowScalar(in, out, 0, begin, width, weights, radius, norm);
+    int x = begin;
+    for (; x + 4 <= end; x += 4) {
+        __m128 sum = _mm_setzero_ps();
+        for (int k = 0; k <= 2 * radius; ++k) {
+            sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(in + x - radius + k), _mm_set1_ps(weights[k])));
+        }
+        _mm_storeu_ps(out + x, _mm_div_ps(sum, _mm_set1_ps(norm)));
+    }
+    BlurRowScalar(in, out, x, width, width, weights, radius, norm);
+}
+
+__attribute__((target("sse4.2")))
+void BlurColumnsSse(const float* const* rows, float* out, int width, const float* weights, int radius, float norm) {
+    int x = 0;
+    for (; x + 4 <= width; x += 4) {
+        __m128 sum = _mm_setzero_ps();
+        for (int k = 0; k <= 2 * radius; ++k) {
+            sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(rows[k] + x), _mm_set1_ps(weights[k])));
+        }
+        _mm_storeu_ps(out + x, _mm_div_ps(sum, _mm_set1_ps(norm)));
+    }
+    BlurColumnsScalar(rows, out, x, width, weights, radius, norm);
+}
+
+__attribute__((target("sse4.2")))
+void SobelRowSse(const float* above, const float* row, const float* below, int width,
+                 float* gx, float* gy, float* magnitude) {
+    const __m128 minusOne = _mm_set1_ps(-1.0f), minusTwo = _mm_set1_ps(-2.0f), two = _mm_set1_ps(2.0f);
+    int x = 1;
+    for (; x + 4 <= width - 1; x += 4) {
+        __m128 a0 = _mm_loadu_ps(above + x - 1), a1 = _mm_loadu_ps(above + x), a2 = _mm_loadu_ps(above + x + 1);
+        __m128 r0 = _mm_loadu_ps(row + x - 1), r2 = _mm_loadu_ps(row + x + 1);
+        __m128 b0 = _mm_loadu_ps(below + x - 1), b1 = _mm_loadu_ps(below + x), b2 = _mm_loadu_ps(below + x + 1);
+        __m128 dx = _mm_add_ps(_mm_mul_ps(minusOne, a0), a2);
+        dx = _mm_add_ps(dx, _mm_mul_ps(minusTwo, r0));
+        dx = _mm_add_ps(dx, _mm_mul_ps(two, r2));
+        dx = _mm_add_ps(dx, _mm_mul_ps(minusOne, b0));
+        dx = _mm_add_ps(dx, b2);
+        __m128 dy = _mm_add_ps(_mm_mul_ps(minusOne, a0), _mm_mul_ps(minusTwo, a1));
+        dy = _mm_add_ps(dy, _mm_mul_ps(minusOne, a2));
+        dy = _mm_add_ps(dy, b0);
+        dy = _mm_add_ps(dy, _mm_mul_ps(two, b1));
+        dy = _mm_add_ps(dy, b2);
+        _mm_storeu_ps(gx + x, dx);
+        _mm_storeu_ps(gy + x, dy);
+        _mm_storeu_ps(magnitude + x, _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy))));
+    }
+    SobelRowScalar(above, row, below, x, width - 1, gx, gy, magnitude);
+}
+
+__attribute__((target("sse4.2")))
+void BlurRowPairSse(const float* in, float* out1, float* out2, int width,
+                 const float* weights1, int radius1, const float* weights2, int radius2) {
+    int begin, end;
+    Interior(width, std::max(radius1, radius2), begin, end);
+    BlurRowPairScalar(in, out1, out2, 0, begin, width, weights1, radius1, weights2, radius2);
+    int x = begin;
+    for (; x + 4 <= end; x += 4) {
+        __m128 sum1 = _mm_setzero_ps(), sum2 = _mm_setzero_ps();
+        for (int k = 0; k <= 2 * radius1; ++k) {
+            sum1 = _mm_add_ps(sum1, _mm_mul_ps(_mm_loadu_ps(in + x - radius1 + k), _mm_set1_ps(weights1[k])));
+        }
+        for (int k = 0; k <= 2 * radius2; ++k) {
+            sum2 = _mm_add_ps(sum2, _mm_mul_ps(_mm_loadu_ps(in + x - radius2 + k), _mm_set1_ps(weights2[k])));
+        }
+        _mm_storeu_ps(out1 + x, sum1);
+        _mm_storeu_ps(out2 + x, sum2);
+    }
+    BlurRowPairScalar(in, out1, out2, x, width, width, weights1, radius1, weights2, radius2);
+}
+
+__attribute__((target("sse4.2")))
+void DifferenceColumnsSse(const float* const* rows1, const float* const* rows2, float* out, int width,
+                       const float* weights1, int radius1, const float* weights2, int radius2, float tau) {
+    int x = 0;
+    for (; x + 4 <= width; x += 4) {
+        __m128 sum1 = _mm_setzero_ps(), sum2 = _mm_setzero_ps();
+        for (int k = 0; k <= 2 * radius1; ++k) {
+            sum1 = _mm_add_ps(sum1, _mm_mul_ps(_mm_loadu_ps(rows1[k] + x), _mm_set1_ps(weights1[k])));
+        }
+        for (int k = 0; k <= 2 * radius2; ++k) {
+            sum2 = _mm_add_ps(sum2, _mm_mul_ps(_mm_loadu_ps(rows2[k] + x), _mm_set1_ps(weights2[k])));
+        }
+        _mm_storeu_ps(out + x, _mm_sub_ps(sum1, _mm_mul_ps(_mm_set1_ps(tau), sum2)));
+    }
+    DifferenceColumnsScalar(rows1, rows2, out, x, width, weights1, radius1, weights2, radius2, tau);
+}
+
+// ---- AVX2 ----
+
+__attribute__((target("avx2")))
+void BlurRowAvx2(const float* in, float* out, int width, const float* weights, int radius, float norm) {
+    int begin, end;
+    Interior(width, radius, begin, end);
+    BlurRowScalar(in, out, 0, begin, width, weights, radius, norm);
+    int x = begin;
+    for (; x + 8 <= end; x += 8) {
+        __m256 sum = _mm256_setzero_ps();
+        for (int k = 0; k <= 2 * radius; ++k) {
+            sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_loadu_ps(in + x - radius + k), _mm256_set1_ps(weights[k])));
+        }
+        _mm256_storeu_ps(out + x, _mm256_div_ps(sum, _mm256_set1_ps(norm)));
+    }
+    BlurRowScalar(in, out, x, width, width, weights, radius, norm);
+}
+
+__attribute__((target("avx2")))
+void BlurColumnsAvx2(const float* const* rows, float* out, int width, const float* weights, int radius, float norm) {
+    int x = 0;
+    for (; x + 8 <= width; x += 8) {
+        __m256 sum = _mm256_setzero_ps();
+        for (int k = 0; k <= 2 * radius; ++k) {
+            sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_loadu_ps(rows[k] + x), _mm256_set1_ps(weights[k])));
+        }
+        _mm256_storeu_ps(out + x, _mm256_div_ps(sum, _mm256_set1_ps(norm)));
+    }
+    BlurColumnsScalar(rows, out, x, width, weights, radius, norm);
+}
+
+__attribute__((target("avx2")))
+void SobelRowAvx2(const float* above, const float* row, const float* below, int width,
+                  float* gx, float* gy, float* magnitude) {
+    const __m256 minusOne = _mm256_set1_ps(-1.0f), minusTwo = _mm256_set1_ps(-2.0f), two = _mm256_set1_ps(2.0f);
+    int x = 1;
+    for (; x + 8 <= width - 1; x += 8) {
+        __m256 a0 = _mm256_loadu_ps(above + x - 1), a1 = _mm256_loadu_ps(above + x), a2 = _mm256_loadu_ps(above + x + 1);
+        __m256 r0 = _mm256_loadu_ps(row + x - 1), r2 = _mm256_loadu_ps(row + x + 1);
+        __m256 b0 = _mm256_loadu_ps(below + x - 1), b1 = _mm256_loadu_ps(below + x), b2 = _mm256_loadu_ps(below + x + 1);
+        __m256 dx = _mm256_add_ps(_mm256_mul_ps(minusOne, a0), a2);
+        dx = _mm256_add_ps(dx, _mm256_mul_ps(minusTwo, r0));
+        dx = _mm256_add_ps(dx, _mm256_mul_ps(two, r2));
+        dx = _mm256_add_ps(dx, _mm256_mul_ps(minusOne, b0));
+        dx = _mm256_add_ps(dx, b2);
+        __m256 dy = _mm256_add_ps(_mm256_mul_ps(minusOne, a0), _mm256_mul_ps(minusTwo, a1));
+        dy = _mm256_add_ps(dy, _mm256_mul_ps(minusOne, a2));
+        dy = _mm256_add_ps(dy, b0);
+        dy = _mm256_add_ps(dy, _mm256_mul_ps(two, b1));
+        dy = _mm256_add_ps(dy, b2);
+        _mm256_storeu_ps(gx + x, dx);
+        _mm256_storeu_ps(gy + x, dy);
+        _mm256_storeu_ps(magnitude + x, _mm256_sqrt_ps(_mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy))));
+    }
+    SobelRowScalar(above, row, below, x, width - 1, gx, gy, magnitude);
+}
+
+__attribute__((target("avx2")))
+void BlurRowPairAvx2(const float* in, float* out1, float* out2, int width,
+                 const float* weights1, int radius1, const float* weights2, int radius2) {
+    int begin, end;
+    Interior(width, std::max(radius1, radius2), begin, end);
+    BlurRowPairScalar(in, out1, out2, 0, begin, width, weights1, radius1, weights2, radius2);
+    int x = begin;
+    for (; x + 8 <= end; x += 8) {
+        __m256 sum1 = _mm256_setzero_ps(), sum2 = _mm256_setzero_ps();
+        for (int k = 0; k <= 2 * radius1; ++k) {
+            sum1 = _mm256_add_ps(sum1, _mm256_mul_ps(_mm256_loadu_ps(in + x - radius1 + k), _mm256_set1_ps(weights1[k])));
+        }
+        for (int k = 0; k <= 2 * radius2; ++k) {
+            sum2 = _mm256_add_ps(sum2, _mm256_mul_ps(_mm256_loadu_ps(in + x - radius2 + k), _mm256_set1_ps(weights2[k])));
+        }
+        _mm256_storeu_ps(out1 + x, sum1);
+        _mm256_storeu_ps(out2 + x, sum2);
+    }
+    BlurRowPairScalar(in, out1, out2, x, width, width, weights1, radius1, weights2, radius2);
+}
+
+__attribute__((target("avx2")))
+void DifferenceColumnsAvx2(const float* const* rows1, const float* const* rows2, float* out, int width,
+                       const float* weights1, int radius1, const float* weights2, int radius2, float tau) {
+    int x = 0;
+    for (; x + 8 <= width; x += 8) {
+        __m256 sum1 = _mm256_setzero_ps(), sum2 = _mm256_setzero_ps();
+        for (int k = 0; k <= 2 * radius1; ++k) {
+            sum1 = _mm256_add_ps(sum1, _mm256_mul_ps(_mm256_loadu_ps(rows1[k] + x), _mm256_set1_ps(weights1[k])));
+        }
+        for (int k = 0; k <= 2 * radius2; ++k) {
+            sum2 = _mm256_add_ps(sum2, _mm256_mul_ps(_mm256_loadu_ps(rows2[k] + x), _mm256_set1_ps(weights2[k])));
+        }
+        _mm256_storeu_ps(out + x, _mm256_sub_ps(sum1, _mm256_mul_ps(_mm256_set1_ps(tau), sum2)));
+    }
+    DifferenceColumnsScalar(rows1, rows2, out, x, width, weights1, radius1, weights2, radius2, tau);
+}
+
+// ---- AVX-512 ----
+
+__attribute__((target("avx512f,avx512bw")))
+void BlurRowAvx512(const float* in, float* out, int width, const float* weights, int radius, float norm) {
+    int begin, end;
+    Interior(width, radius, begin, end);
+    BlurRowScalar(in, out, 0, begin, width, weights, radius, norm);
+    int x = begin;
+    for (; x + 16 <= end; x += 16) {
+        __m512 sum = _mm512_setzero_ps();
+        for (int k = 0; k <= 2 * radius; ++k) {
+            sum = _mm512_add_ps(sum, _mm512_mul_ps(_mm512_loadu_ps(in + x - radius + k), _mm512_set1_ps(weights[k])));
+        }
+        _mm512_storeu_ps(out + x, _mm512_div_ps(sum, _mm512_set1_ps(norm)));
+    }
+    BlurRowScalar(in, out, x, width, width, weights, radius, norm);
+}
+
+__attribute__((target("avx512f,avx512bw")))
+void BlurColumnsAvx512(const float* const* rows, float* out, int width, const float* weights, int radius, float norm) {
+    int x = 0;
+    for (; x + 16 <= width; x += 16) {
+        __m512 sum = _mm512_setzero_ps();
+        for (int k = 0; k <= 2 * radius; ++k) {
+            sum = _mm512_add_ps(sum, _mm512_mul_ps(_mm512_loadu_ps(rows[k] + x), _mm512_set1_ps(weights[k])));
+        }
+        _mm512_storeu_ps(out + x, _mm512_div_ps(sum, _mm512_set1_ps(norm)));
+    }
+    BlurColumnsScalar(rows, out, x, width, weights, radius, norm);
+}
+
+__attribute__((target("avx512f,avx512bw")))
+void SobelRowAvx512(const float* above, const float* row, const float* below, int width,
+                    float* gx, float* gy, float* magnitude) {
+    const __m512 minusOne = _mm512_set1_ps(-1.0f), minusTwo = _mm512_set1_ps(-2.0f), two = _mm512_set1_ps(2.0f);
+    int x = 1;
+    for (; x + 16 <= width - 1; x += 16) {
+        __m512 a0 = _mm512_loadu_ps(above + x - 1), a1 = _mm512_loadu_ps(above + x), a2 = _mm512_loadu_ps(above + x + 1);
+        __m512 r0 = _mm512_loadu_ps(row + x - 1), r2 = _mm512_loadu_ps(row + x + 1);
+        __m512 b0 = _mm512_loadu_ps(below + x - 1), b1 = _mm512_loadu_ps(below + x), b2 = _mm512_loadu_ps(below + x + 1);
+        __m512 dx = _mm512_add_ps(_mm512_mul_ps(minusOne, a0), a2);
+        dx = _mm512_add_ps(dx, _mm512_mul_ps(minusTwo, r0));
+        dx = _mm512_add_ps(dx, _mm512_mul_ps(two, r2));
+        dx = _mm512_add_ps(dx, _mm512_mul_ps(minusOne, b0));
+        dx = _mm512_add_ps(dx, b2);
+        __m512 dy = _mm512_add_ps(_mm512_mul_ps(minusOne, a0), _mm512_mul_ps(minusTwo, a1));
+        dy = _mm512_add_ps(dy, _mm512_mul_ps(minusOne, a2));
+        dy = _mm512_add_ps(dy, b0);
+        dy = _mm512_add_ps(dy, _mm512_mul_ps(two, b1));
+        dy = _mm512_add_ps(dy, b2);
+        _mm512_storeu_ps(gx + x, dx);
+        _mm512_storeu_ps(gy + x, dy);
+        _mm512_storeu_ps(magnitude + x, _mm512_sqrt_ps(_mm512_add_ps(_mm512_mul_ps(dx, dx), _mm512_mul_ps(dy, dy))));
+    }
+    SobelRowScalar(above, row, below, x, width - 1, gx, gy, magnitude);
+}
+
+__attribute__((target("avx512f,avx512bw")))
+void BlurRowPairAvx512(const float* in, float* out1, float* out2, int width,
+                 const float* weights1, int radius1, const float* weights2, int radius2) {
+    int begin, end;
+    Interior(width, std::max(radius1, radius2), begin, end);
+    BlurRowPairScalar(in, out1, out2, 0, begin, width, weights1, radius1, weights2, radius2);
+    int x = begin;
+    for (; x + 16 <= end; x += 16) {
+        __m512 sum1 = _mm512_setzero_ps(), sum2 = _mm512_setzero_ps();
+        for (int k = 0; k <= 2 * radius1; ++k) {
+            sum1 = _mm512_add_ps(sum1, _mm512_mul_ps(_mm512_loadu_ps(in + x - radius1 + k), _mm512_set1_ps(weights1[k])));
+        }
+        for (int k = 0; k <= 2 * radius2; ++k) {
+            sum2 = _mm512_add_ps(sum2, _mm512_mul_ps(_mm512_loadu_ps(in + x - radius2 + k), _mm512_set1_ps(weights2[k])));
+        }
+        _mm512_storeu_ps(out1 + x, sum1);
+        _mm512_storeu_ps(out2 + x, sum2);
+    }
+    BlurRowPairScalar(in, out1, out2, x, width, width, weights1, radius1, weights2, radius2);
+}
+
+__attribute__((target("avx512f,avx512bw")))
+void DifferenceColumnsAvx512(const float* const* rows1, const float* const* rows2, float* out, int width,
+                       const float* weights1, int radius1, const float* weights2, int radius2, float tau) {
+    int x = 0;
+    for (; x + 16 <= width; x += 16) {
+        __m512 sum1 = _mm512_setzero_ps(), sum2 = _mm512_setzero_ps();
+        for (int k = 0; k <= 2 * radius1; ++k) {
+            sum1 = _mm512_add_ps(sum1, _mm512_mul_ps(_mm512_loadu_ps(rows1[k] + x), _mm512_set1_ps(weights1[k])));
+        }
+        for (int k = 0; k <= 2 * radius2; ++k) {
+            sum2 = _mm512_add_ps(sum2, _mm512_mul_ps(_mm512_loadu_ps(rows2[k] + x), _mm512_set1_ps(weights2[k])));
+        }
+        _mm512_storeu_ps(out + x, _mm512_sub_ps(sum1, _mm512_mul_ps(_mm512_set1_ps(tau), sum2)));
+    }
+    DifferenceColumnsScalar(rows1, rows2, out, x, width, weights1, radius1, weights2, radius2, tau);
+}
+
+#endif
+
+struct Kernels {
+    void (*blurRow)(const float*, float*, int, const float*, int, float);
+    void (*blurColumns)(const float* const*, float*, int, const float*, int, float);
+    void (*sobelRow)(const float*, const float*, const float*, int, float*, float*, float*);
+    void (*blurRowPair)(const float*, float*, float*, int, const float*, int, const float*, int);
+    void (*differenceColumns)(const float* const*, const float* const*, float*, int,
+                              const float*, int, const float*, int, float);
+};
+
+Kernels SelectKernels() {
+    Kernels kernels = {
+        [](const float* in, float* out, int width, const float* weights, int radius, float norm) {
+            BlurRowScalar(in, out, 0, width, width, weights, radius, norm);
+        },
+        [](const float* const* rows, float* out, int width, const float* weights, int radius, float norm) {
+            BlurColumnsScalar(rows, out, 0, width, weights, radius, norm);
+        },
+        [](const float* above, const float* row, const float* below, int width, float* gx, float* gy, float* magnitude) {
+            SobelRowScalar(above, row, below, 1, width - 1, gx, gy, magnitude);
+        },
+        [](const float* in, float* out1, float* out2, int width,
+           const float* weights1, int radius1, const float* weights2, int radius2) {
+            BlurRowPairScalar(in, out1, out2, 0, width, width, weights1, radius1, weights2, radius2);
+        },
+        [](const float* const* rows1, const float* const* rows2, float* out, int width,
+           const float* weights1, int radius1, const float* weights2, int radius2, float tau) {
+            DifferenceColumnsScalar(rows1, rows2, out, 0, width, weights1, radius1, weights2, radius2, tau);
+        },
+    };
+#ifdef CPU_DISPATCH_X86
+    switch (cpu_dispatch::activeIsa()) {
+        case cpu_dispatch::Isa::AVX512:
+            kernels = {BlurRowAvx512, BlurColumnsAvx512, SobelRowAvx512, BlurRowPairAvx512, DifferenceColumnsAvx512};
+            break;
+        case cpu_dispatch::Isa::AVX2:
+            kernels = {BlurRowAvx2, BlurColumnsAvx2, SobelRowAvx2, BlurRowPairAvx2, DifferenceColumnsAvx2};
+            break;
+        case cpu_dispatch::Isa::SSE42:
+            kernels = {BlurRowSse, BlurColumnsSse, SobelRowSse, BlurRowPairSse, DifferenceColumnsSse};
+            break;
+        default:
+            break;
+    }
+#endif
+    return kernels;
+}
+
+const Kernels& Bound() {
+    static const Kernels kernels = SelectKernels();
+    return kernels;
+}
+
+}
+
+void blurRow(const float* in, float* out, int width, const float* weights, int radius, float norm) {
+    Bound().blurRow(in, out, width, weights, radius, norm);
+}
+
+void blurColumns(const float* const* rows, float* out, int width, const float* weights, int radius, float norm) {
+    Bound().blurColumns(rows, out, width, weights, radius, norm);
+}
+
+void sobelRow(const float* above, const float* row, const float* below, int width,
+              float* gx, float* gy, float* magnitude) {
+    Bound().sobelRow(above, row, below, width, gx, gy, magnitude);
+}
+
+void blurRowPair(const float* in, float* out1, float* out2, int width,
+                 const float* weights1, int radius1, const float* weights2, int radius2) {
+    Bound().blurRowPair(in, out1, out2, width, weights1, radius1, weights2, radius2);
+}
+
+void differenceColumns(const float* const* rows1, const float* const* rows2, float* out, int width,
+                       const float* weights1, int radius1, const float* weights2, int radius2, float tau) {
+    Bound().differenceColumns(rows1, rows2, out, width, weights1, radius1, weights2, radius2, tau);
+}
+
+}
@@ -0,0 +1,234 @@
+//
+// Created by Dhruva Sharma on 18/2/25.
+//
+
+#include "headers/gaussian_blur.h"
+#include "headers/filter_kernels.h"
+#include "headers/thread_pool.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace gaussian_blur {
+
+namespace {
+
+// y[n] = b * x[n] + a1 * y[n - 1] + a2 * y[n - 2] + a3 * y[n - 3], run forwards and then backwards.
+// b = 1 - (a1 + a2 + a3), so a constant signal passes unchanged: starting the forward pass from the
+// first value is exactly an extended left edge. The right edge is not that simple, because the
+// forward pass has not settled by the last value; following Triggs & Sdika, "Boundary conditions
+// for Young - van Vliet recursive filtering" (2006), the backward pass starts from
+// y[n + k] = u + sum_j m[k][j] * (w[n - 1 - j] - u), where w is the forward output, u the last
+// input value and n the length.
+struct Coefficients {
+    float b, a1, a2, a3;
+    float m[3][3];
+};
+
+// Young & van Vliet, "Recursive implementation of the Gaussian filter" (1995); valid for sigma >= 0.5
+Coefficients YoungVanVliet(float sigma) {
+    double q = sigma >= 2.5f ? 0.98711 * sigma - 0.96330 : 3.97156 - 4.14554 * std::sqrt(1.0 - 0.26891 * sigma);
+    double q2 = q * q, q3 = q2 * q;
+    double b0 = 1.57825 + 2.44413 * q + 1.4281 * q2 + 0.422205 * q3;
+    double b1 = 2.44413 * q + 2.85619 * q2 + 1.26661 * q3;
+    double b2 = -(1.4281 * q2 + 1.26661 * q3);
+    double b3 = 0.422205 * q3;
+    Coefficients c;
+    c.a1 = static_cast<float>(b1 / b0);
+    c.a2 = static_cast<float>(b2 / b0);
+    c.a3 = static_cast<float>(b3 / b0);
+    c.b = 1.0f - (c.a1 + c.a2 + c.a3);
+
+    // m is linear in the three deviations, so run each unit deviation through both passes past
+    // the edge, long enough for the filter's response to have died away
+    int steps = static_cast<int>(20 * sigma) + 64;
+    std::vector<double> forward(steps + 6), backward(steps + 6);
+    for (int j = 0; j < 3; ++j) {
+        // Index i is sample n - 3 + i
+        std::fill(forward.begin(), forward.end(), 0.0);
+        std::fill(backward.begin(), backward.end(), 0.0);
+        forward[2 - j] = 1.0;
+        for (int i = 3; i < steps + 3; ++i) {
+            forward[i] = c.a1 * forward[i - 1] + c.a2 * forward[i - 2] + c.a3 * forward[i - 3];
+        }
+        for (int i = steps + 2; i >= 3; --i) {
+            backward[i] = c.b * forward[i] + c.a1 * backward[i + 1] + c.a2 * backward[i + 2] + c.a3 * backward[i + 3];
+        }
+        for (int k = 0; k < 3; ++k) c.m[k][j] = static_cast<float>(backward[3 + k]);
+    }
+    return c;
+}
+
+void RecurseRow(float* line, int n, const Coefficients& c) {
+    float u = line[n - 1];
+    float y1 = line[0], y2 = y1, y3 = y1;
+    for (int i = 0; i < n; ++i) {
+        float y = c.b * line[i] + c.a1 * y1 + c.a2 * y2 + c.a3 * y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = line[i] = y;
+    }
+    float d[3];
+    for (int j = 0; j < 3; ++j) d[j] = line[std::max(0, n - 1 - j)] - u;
+    float next[3];
+    for (int k = 0; k < 3; ++k) next[k] = u + c.m[k][0] * d[0] + c.m[k][1] * d[1] + c.m[k][2] * d[2];
+    y1 = next[0];
+    y2 = next[1];
+    y3 = next[2];
+    for (int i = n - 1; i >= 0; --i) {
+        float y = c.b * line[i] + c.a1 * y1 + c.a2 * y2 + c.a3 * y3;
+        y3 = y2;
+        y2 = y1;
+        y1 = line[i] = y;
+    }
+}
+
+// The same recursion down columns [x0, x1), a row at a time so the inner loop runs across pixels.
+// Rows above the first are the first row itself, already filtered: its own step leaves it
+// unchanged, as for any constant signal. tail holds four rows of width: the last input row, then
+// the three rows past the bottom edge that the backward pass starts from.
+void RecurseColumns(float* plane, int width, int height, int x0, int x1, const Coefficients& c, float* tail) {
+    auto row = [&](int y) { return plane + static_cast<size_t>(std::max(0, std::min(y, height - 1))) * width; };
+    float* last = tail;
+    std::copy(row(height - 1) + x0, row(height - 1) + x1, last + x0);
+    for (int y = 0; y < height; ++y) {
+        float* r = row(y);
+        const float *p1 = row(y - 1), *p2 = row(y - 2), *p3 = row(y - 3);
+        for (int x = x0; x < x1; ++x) r[x] = c.b * r[x] + c.a1 * p1[x] + c.a2 * p2[x] + c.a3 * p3[x];
+    }
+    const float *d0 = row(height - 1), *d1 = row(height - 2), *d2 = row(height - 3);
+    for (int k = 0; k < 3; ++k) {
+        float* next = tail + (k + 1) * width;
+        for (int x = x0; x < x1; ++x) {
+            next[x] = last[x] + c.m[k][0] * (d0[x] - last[x]) + c.m[k][1] * (d1[x] - last[x]) +
+                      c.m[k][2] * (d2[x] - last[x]);
+        }
+    }
+    auto below = [&](int y) { return y < height ? row(y) : tail + (y - height + 1) * width; };
+    for (int y = height - 1; y >= 0; --y) {
+        float* r = row(y);
+        const float *n1 = below(y + 1), *n2 = below(y + 2), *n3 = below(y + 3);
+        for (int x = x0; x < x1; ++x) r[x] = c.b * r[x] + c.a1 * n1[x] + c.a2 * n2[x] + c.a3 * n3[x];
+    }
+}
+
+}
+
+std::vector<float> taps(float sigma, int& radius) {
+    if (!(sigma > 0.0f)) {
+        radius = 0;
+        return {1.0f};
+    }
+    radius = static_cast<int>(std::ceil(sigma * 3));
+    std::vector<float> weights(2 * radius + 1);
+    float sum = 0.0f;
+    for (int k = -radius; k <= radius; ++k) {
+        weights[k + radius] = std::exp(-(k * k) / (2.0f * sigma * sigma));
+        sum += weights[k + radius];
+    }
+    for (float& weight : weights) weight /= sum;
+    return weights;
+}
+
+void convolve(const float* in, float* out, int width, int height, const float* taps, int radius) {
+    if (width < 1 || height < 1) return;
+    std::vector<float> temp(static_cast<size_t>(width) * height);
+    thread_pool::parallelFor(0, height, 0, [&](int first, int last) {
+        for (int y = first; y < last; ++y) {
+            filter_kernels::blurRow(&in[y * width], &temp[y * width], width, taps, radius, 1.0f);
+        }
+    });
+    thread_pool::parallelFor(0, height, 0, [&](int first, int last) {
+        std::vector<const float*> rows(2 * radius + 1);
+        for (int x0 = 0; x0 < width; x0 += kStripWidth) {
+            int stripWidth = std::min(kStripWidth, width - x0);
+            for (int y = first; y < last; ++y) {
+                for (int k = -radius; k <= radius; ++k) {
+                    rows[k + radius] = &temp[std::max(0, std::min(y + k, height - 1)) * width + x0];
+                }
+                filter_kernels::blurColumns(rows.data(), &out[y * width + x0], stripWidth, taps, radius, 1.0f);
+            }
+        }
+    });
+}
+
+void recursive(const float* in, float* out, int width, int height, float sigma) {
+    if (width < 1 || height < 1) return;
+    if (sigma < 0.5f) {
+        int radius;
+        std::vector<float> weights = taps(sigma, radius);
+        convolve(in, out, width, height, weights.data(), radius);
+        return;
+    }
+    Coefficients c = YoungVanVliet(sigma);
+    thread_pool::parallelFor(0, height, 0, [&](int first, int last) {
+        for (int y = first; y < last; ++y) {
+            std::memcpy(&out[y * width], &in[y * width], width * sizeof(float));
+            RecurseRow(&out[y * width], width, c);
+        }
+    });
+    int strips = (width + kStripWidth - 1) / kStripWidth;
+    thread_pool::parallelFor(0, strips, 1, [&](int first, int last) {
+        std::vector<float> tail(4 * static_cast<size_t>(width));
+        for (int strip = first; strip < last; ++strip) {
+            int x0 = strip * kStripWidth;
+            RecurseColumns(out, width, height, x0, std::min(width, x0 + kStripWidth), c, tail.data());
+        }
+    });
+}
+
+void blur(const float* in, float* out, int width, int height, float sigma) {
+    if (sigma > kRecursiveSigma) {
+        recursive(in, out, width, height, sigma);
+        return;
+    }
+    int radius;
+    std::vector<float> weights = taps(sigma, radius);
+    convolve(in, out, width, height, weights.data(), radius);
+}
+
+void difference(const float* in, float* out, int width, int height, float sigma1, float sigma2, float tau) {
+    if (width < 1 || height < 1) return;
+    if (std::max(sigma1, sigma2) > kRecursiveSigma) {
+        // Past the point where the FIR kernels cost more than the recursive filter
+        std::vector<float> blur1(width * height), blur2(width * height);
+        blur(in, blur1.data(), width, height, sigma1);
+        blur(in, blur2.data(), width, height, sigma2);
+        for (int i = 0; i < width * height; ++i) {
+            out[i] = blur1[i] - tau * blur2[i];
+        }
+        return;
+    }
+    int radius1, radius2;
+    std::vector<float> weights1 = taps(sigma1, radius1);
+    std::vector<float> weights2 = taps(sigma2, radius2);
+
+    // Horizontal: both blurs of a row in one sweep
+    std::vector<float> blur1(width * height), blur2(width * height);
+    thread_pool::parallelFor(0, height, 0, [&](int first, int last) {
+        for (int y = first; y < last; ++y) {
+            filter_kernels::blurRowPair(&in[y * width], &blur1[y * width], &blur2[y * width], width,
+                                        weights1.data(), radius1, weights2.data(), radius2);
+        }
+    });
+
+    // Vertical, a strip of columns at a time, writing the difference directly
+    thread_pool::parallelFor(0, height, 0, [&](int first, int last) {
+        std::vector<const float*> rows1(weights1.size()), rows2(weights2.size());
+        for (int x0 = 0; x0 < width; x0 += kStripWidth) {
+            int stripWidth = std::min(kStripWidth, width - x0);
+            for (int y = first; y < last; ++y) {
+                for (int k = -radius1; k <= radius1; ++k) {
+                    rows1[k + radius1] = &blur1[std::max(0, std::min(y + k, height - 1)) * width + x0];
+                }
+                for (int k = -radius2; k <= radius2; ++k) {
+                    rows2[k + radius2] = &blur2[std::max(0, std::min(y + k, height - 1)) * width + x0];
+                }
+                filter_kernels::differenceColumns(rows1.data(), rows2.data(), &out[y * width + x0], stripWidth,
+                                                  weights1.data(), radius1, weights2.data(), radius2, tau);
+            }
+        }
+    });
+}
+
+}
@@ -0,0 +1,64 @@
+//
+// Created by Dhruva Sharma on 18/2/25.
+//
+
+#include "headers/glyph_blit.h"
+#include <cstring>
+#include <functional>
+
+namespace glyph_blit {
+
+uint32_t pack(const unsigned char* rgba) {
+    uint32_t color;
+    std::memcpy(&color, rgba, sizeof(color));
+    return color;
+}
+
+void fill(unsigned char* out, int count, uint32_t color) {
+    for (int i = 0; i < count; ++i) std::memcpy(out + 4 * i, &color, sizeof(color));
+}
+
+std::size_t TileCache::KeyHash::operator()(const Key& key) const {
+    uint64_t colors = (static_cast<uint64_t>(key.fg) << 32) | key.bg;
+    return std::hash<const unsigned char*>()(key.rows) ^ std::hash<uint64_t>()(colors * 0x9E3779B97F4A7C15ULL);
+}
+
+TileCache::TileCache(int cellSize, int scale) : cellSize_(cellSize), scale_(scale), size_(cellSize * scale) {}
+
+const unsigned char* TileCache::tile(const unsigned char* rows, uint32_t fg, uint32_t bg) {
+    Key key = {rows, fg, bg};
+    auto found = offsets_.find(key);
+    if (found != offsets_.end()) return tiles_.data() + found->second;
+    if (offsets_.size() == kMaxTiles) {
+        offsets_.clear();
+        tiles_.clear();
+    }
+    std::size_t offset = tiles_.size();
+    tiles_.resize(offset + 4 * static_cast<std::size_t>(size_) * size_);
+    Rasterize(rows, fg, bg, tiles_.data() + offset);
+    offsets_.emplace(key, offset);
+    return tiles_.data() + offset;
+}
+
+void TileCache::blit(const unsigned char* tile, unsigned char* frame, int frameWidth, int x, int y) const {
+    std::size_t rowBytes = 4 * static_cast<std::size_t>(size_);
+    for (int row = 0; row < size_; ++row) {
+        std::memcpy(frame + 4 * (static_cast<std::size_t>(y + row) * frameWidth + x), tile + row * rowBytes, rowBytes);
+    }
+}
+
+void TileCache::Rasterize(const unsigned char* rows, uint32_t fg, uint32_t bg, unsigned char* out) const {
+    std::size_t rowBytes = 4 * static_cast<std::size_t>(size_);
+    for (int row = 0; row < cellSize_; ++row) {
+        // One output row per glyph row, then copies of it for the rest of the scale
+        unsigned char* line = out + row * scale_ * rowBytes;
+        unsigned bits = row < 8 ? rows[row] : 0;
+        for (int col = 0; col < cellSize_; ++col) {
+            bool on = col < 8 && (bits >> col) & 1; // bit 0 is the leftmost pixel
+            fill(line + 4 * col * scale_, scale_, on ? fg : bg);
+        }
+        for (int copy = 1; copy < scale_; ++copy) std::memcpy(line + copy * rowBytes, line, rowBytes);
+    }
+}
+
+}
@@ -0,0 +1,110 @@
+//
+// Created by Dhruva Sharma on 18/2/25.
+//
+
+#include "headers/glyph_match.h"
+#include "headers/cpu_dispatch.h"
+
+namespace glyph_match {
+
+namespace {
+
+// Portable fallback; GCC and Clang lower the builtin to shifts and masks without a POPCNT target
+int Popcount(uint64_t value) {
+#if defined(__GNUC__)
+    return __builtin_popcountll(value);
+#else
+    return popcount(value);
+#endif
+}
+
+int NearestScalar(const uint64_t* masks, int count, uint64_t tile) {
+    int best = 0, bestDistance = 65;
+    for (int i = 0; i < count; ++i) {
+        int distance = Popcount(masks[i] ^ tile);
+        if (distance < bestDistance) {
+            bestDistance = distance;
+            best = i;
+        }
+    }
+    return best;
+}
+
+int NearestWeightedScalar(const uint64_t* masks, int count, const TileMask& tile) {
+    int best = 0, bestDistance = 3 * 64 + 1;
+    for (int i = 0; i < count; ++i) {
+        uint64_t mismatch = masks[i] ^ tile.bits;
+        int distance = Popcount(mismatch) + Popcount(mismatch & tile.confident) + Popcount(mismatch & tile.certain);
+        if (distance < bestDistance) {
+            bestDistance = distance;
+            best = i;
+        }
+    }
+    return best;
+}
+
+#ifdef CPU_DISPATCH_X86
+
+// ---- POPCNT, which every CPU with SSE4.2 also has ----
+
+__attribute__((target("sse4.2,popcnt")))
+int NearestPopcnt(const uint64_t* masks, int count, uint64_t tile) {
+    int best = 0, bestDistance = 65;
+    for (int i = 0; i < count; ++i) {
+        int distance = __builtin_popcountll(masks[i] ^ tile);
+        if (distance < bestDistance) {
+            bestDistance = distance;
+            best = i;
+        }
+    }
+    return best;
+}
+
+__attribute__((target("sse4.2,popcnt")))
+int NearestWeightedPopcnt(const uint64_t* masks, int count, const TileMask& tile) {
+    int best = 0, bestDistance = 3 * 64 + 1;
+    for (int i = 0; i < count; ++i) {
+        uint64_t mismatch = masks[i] ^ tile.bits;
+        int distance = __builtin_popcountll(mismatch) + __builtin_popcountll(mismatch & tile.confident) +
+                       __builtin_popcountll(mismatch & tile.certain);
+        if (distance < bestDistance) {
+            bestDistance = distance;
+            best = i;
+        }
+    }
+    return best;
+}
+
+#endif
+
+struct Kernels {
+    int (*nearest)(const uint64_t*, int, uint64_t);
+    int (*nearestWeighted)(const uint64_t*, int, const TileMask&);
+};
+
+Kernels SelectKernels() {
+    Kernels kernels = {NearestScalar, NearestWeightedScalar};
+#ifdef CPU_DISPATCH_X86
+    if (cpu_dispatch::activeIsa() >= cpu_dispatch::Isa::SSE42) {
+        kernels = {NearestPopcnt, NearestWeightedPopcnt};
+    }
+#endif
+    return kernels;
+}
+
+const Kernels& Bound() {
+    static const Kernels kernels = SelectKernels();
+    return kernels;
+}
+
+}
+
+int nearest(const uint64_t* masks, int count, uint64_t tile) {
+    return Bound().nearest(masks, count, tile);
+}
+
+int nearestWeighted(const uint64_t* masks, int count, const TileMask& tile) {
+    return Bound().nearestWeighted(masks, count, tile);
+}
+
+}
@@ -0,0 +1,104 @@
+//
+// Created by Dhruva Sharma on 18/2/25.
+//
+
+#include "headers/gray_pipeline.h"
+#include "headers/pixel_kernels.h"
+#include "headers/thread_pool.h"
+#include <algorithm>
+#include <cmath>
+
+namespace gray_pipeline {
+
+bool canUse(const Pallete& pallete) {
+    return pallete.getSize() <= 256 && pallete.isGrayScale();
+}
+
+std::vector<unsigned char> decodeGray8(const Image& image) {
+    int width = image.getWidth();
+    int height = image.getHeight();
+    std::vector<unsigned char> gray(static_cast<size_t>(width) * height);
+    thread_pool::parallelFor(0, height, 0, [&](int first, int last) {
+        for (int y = first; y < last; ++y) {
+            pixel_kernels::colorsToGray8(image.getRow(y), gray.data() + static_cast<size_t>(y) * width, width);
+        }
+    });
+    return gray;
+}
+
+void emitIndices(const std::vector<unsigned char>& indices, int width, int height,
+                 const Pallete& pallete, Image& outputImage) {
+    outputImage = Image(width, height);
+    thread_pool::parallelFor(0, height, 0, [&](int first, int last) {
+        for (int y = first; y < last; ++y) {
+            const unsigned char* in = indices.data() + static_cast<size_t>(y) * width;
+            Color* row = outputImage.getRow(y);
+            for (int x = 0; x < width; ++x) {
+                row[x] = pallete.getColor(in[x]);
+            }
+        }
+    });
+}
+
+GrayLevels::GrayLevels(const Pallete& pallete) {
+    int size = pallete.getSize();
+    std::vector<int> order(size);
+    for (int i = 0; i < size; ++i) {
+        const Color& color = pallete.getColor(i);
+        paletteLevels_.push_back((color.r + color.g + color.b) / 3.0f * 255.0f);
+        order[i] = i;
+    }
+    // Stable so that, as in GetClosestColor, the earlier palette entry wins between equal levels
+    std::stable_sort(order.begin(), order.end(), [this](int a, int b) {
+        return paletteLevels_[a] < paletteLevels_[b];
+    });
+    for (int index : order) {
+        if (!sortedLevels_.empty() && sortedLevels_.back() == paletteLevels_[index]) continue;
+        sortedLevels_.push_back(paletteLevels_[index]);
+        sortedIndex_.push_back(index);
+    }
+    for (size_t i = 1; i < sortedLevels_.size(); ++i) {
+        midpoints_.push_back((sortedLevels_[i - 1] + sortedLevels_[i]) * 0.5f);
+    }
+
+    int position = 0;
+    int last = static_cast<int>(midpoints_.size());
+    for (int v = 0; v < 256; ++v) {
+        while (position < last && v > midpoints_[position]) ++position;
+        nearest_[v] = position;
+    }
+
+    // Outside the palette range both ends of the step are the outermost entry
+    int below = 0;
+    int count = static_cast<int>(sortedLevels_.size());
+    for (int v = 0; v < 256; ++v) {
+        Step& step = steps_[v];
+        if (count == 0) {
+            step = {0, 0, 0.0f};
+            continue;
+        }
+        while (below + 1 < count && sortedLevels_[below + 1] <= v) ++below;
+        if (v < sortedLevels_[0] || below + 1 == count) {
+            int edge = v < sortedLevels_[0] ? 0 : count - 1;
+            unsigned char index = static_cast<unsigned char>(sortedIndex_[edge]);
+            step = {index, index, 0.0f};
+            continue;
+        }
+        float low = sortedLevels_[below];
+        float high = sortedLevels_[below + 1];
+        step = {static_cast<unsigned char>(sortedIndex_[below]),
+                static_cast<unsigned char>(sortedIndex_[below + 1]), (v - low) / (high - low)};
+    }
+}
+
+int GrayLevels::closestIndex(float value) const {
+    if (sortedIndex_.empty()) return 0;
+    // The table is exact at integer levels; at most a step or two remains for the fraction
+    int v = std::max(0, std::min(255, static_cast<int>(value)));
+    int position = nearest_[v];
+    int last = static_cast<int>(midpoints_.size());
+    while (position < last && value > midpoints_[position]) ++position;
+    return sortedIndex_[position];
+}
+
+}
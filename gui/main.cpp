@@ -9,6 +9,15 @@
 #include "headers/threshold_dithrer.h"
 #include "headers/floyd_dithrer.h"
 #include "headers/ascii_dithrer.h"
+#include "headers/dot_diffusion_dithrer.h"
+#include "headers/ostromoukhov_dithrer.h"
+#include "headers/riemersma_dithrer.h"
+#include "headers/blue_noise_dithrer.h"
+#include "headers/yliluoma_dithrer.h"
+#include "headers/halftone_dithrer.h"
+#include "headers/noise_dithrer.h"
+#include "headers/thread_pool.h"
+#include "headers/cpu_dispatch.h"
 
 void printUsage(const char* programName) {
     std::cout << "DitherBoy - Image Dithering Tool\n";
@@ -16,20 +25,29 @@ void printUsage(const char* programName) {
     std::cout << "Usage: " << programName << " [OPTIONS] <input_file> <output_file>\n\n";
     std::cout << "Options:\n";
     std::cout << "  -h, --help              Show this help message\n";
-    std::cout << "  -m, --method METHOD     Dithering method (floyd, atkinson, ordered, threshold, ascii)\n";
+    std::cout << "  -m, --method METHOD     Dithering method (floyd, atkinson, ostromoukhov, ordered, threshold, ascii, dot, dotopt, riemersma, bluenoise, yliluoma, halftone, noise, tpdf)\n";
     std::cout << "  -a, --ascii-set SET     ASCII character set (basic, extended, artistic, simple, shader, retro)\n";
+    std::cout << "  -g, --glyph-match MODE  ASCII glyphs by tile shape (none, hamming, weighted; default: none)\n";
     std::cout << "  -p, --palette PALETTE   Color palette (grayscale:N, gameboy, nes, cga)\n";
-    std::cout << "  -b, --bayer SIZE        Bayer matrix size for ordered dithering (1-4)\n";
+    std::cout << "  -b, --bayer SIZE        Bayer matrix order for ordered dithering (1-8, 2x2 to 256x256)\n";
+    std::cout << "  -n, --noise-size SIZE   Blue-noise mask size (64, 128, 256)\n";
+    std::cout << "  -c, --cell SIZE         Halftone cell size in pixels (2-24, default: 8)\n";
+    std::cout << "  -k, --cmyk              Halftone as CMYK separations composited over paper\n";
+    std::cout << "  -r, --seed SEED         Noise seed for noise and tpdf dithering (default: 0)\n";
     std::cout << "  -t, --threshold VALUE   Threshold value for threshold dithering (0.0-1.0)\n";
+    std::cout << "  -s, --serpentine        Serpentine scanning for error diffusion (floyd, atkinson)\n";
+    std::cout << "  -l, --raster            Raster scanning for ostromoukhov, which scans serpentine by default\n";
     std::cout << "  -f, --format FORMAT     Output format (png, jpg, bmp)\n";
-    std::cout << "  -q, --quality QUALITY   JPEG quality (1-100, default: 95)\n\n";
+    std::cout << "  -q, --quality QUALITY   JPEG quality (1-100, default: 95)\n";
+    std::cout << "  -j, --threads COUNT     Worker threads, 0 for one per core (default: 0)\n\n";
     std::cout << "Examples:\n";
     std::cout << "  " << programName << " input.png output.png -m floyd -p grayscale:4\n";
     std::cout << "  " << programName << " input.png output.png -m ordered -b 2 -p gameboy\n";
     std::cout << "  " << programName << " input.png output.png -m atkinson -p nes\n";
     std::cout << "  " << programName << " input.png output.png -m threshold -t 0.5 -p cga\n";
     std::cout << "  " << programName << " input.png output.txt -m ascii -a shader\n";
-    std::cout << "  " << programName << " input.png output.txt -m ascii -a retro\n\n";
+    std::cout << "  " << programName << " input.png output.txt -m ascii -a retro\n";
+    std::cout << "  " << programName << " input.png output.txt -m ascii -a font8x8 -g weighted\n\n";
     std::cout << "Palettes:\n";
     std::cout << "  grayscale:N  - N-level grayscale (2-256)\n";
     std::cout << "  gameboy      - Classic GameBoy 4-color green palette\n";
@@ -42,7 +60,16 @@ enum class DitherMethod {
     ATKINSON,
     ORDERED,
     THRESHOLD,
-    ASCII
+    ASCII,
+    DOT_DIFFUSION,
+    DOT_DIFFUSION_OPTIMIZED,
+    OSTROMOUKHOV,
+    RIEMERSMA,
+    BLUE_NOISE,
+    YLILUOMA,
+    HALFTONE,
+    NOISE,
+    TPDF_NOISE
 };
 
 enum class PaletteType {
@@ -59,11 +86,19 @@ struct Config {
     PaletteType paletteType = PaletteType::GRAYSCALE;
     int grayscaleLevels = 4;
     int bayerSize = 2;
+    int noiseSize = 64;
+    float cellSize = 8.0f;
+    bool cmyk = false;
+    unsigned long long seed = 0;
     float threshold = 0.5f;
     std::string format = "png";
     int quality = 95;
     AsciiCharSet asciiCharSet = AsciiCharSet::EXTENDED;
     bool detectEdges = true;
+    GlyphMatching glyphMatching = GlyphMatching::NONE;
+    bool serpentine = false;
+    bool raster = false;
+    int threads = 0;
 };
 
 Pallete createPalette(const Config& config) {
@@ -112,16 +147,43 @@ Pallete createPalette(const Config& config) {
 
 std::unique_ptr<Dither> createDitherer(const Config& config) {
     switch (config.method) {
-        case DitherMethod::FLOYD:
-            return std::make_unique<FloydDithrer>();
-        case DitherMethod::ATKINSON:
-            return std::make_unique<AtkinsonDithrer>();
+        case DitherMethod::FLOYD: {
+            auto ditherer = std::make_unique<FloydDithrer>();
+            ditherer->setSerpentine(config.serpentine);
+            return ditherer;
+        }
+        case DitherMethod::ATKINSON: {
+            auto ditherer = std::make_unique<AtkinsonDithrer>();
+            ditherer->setSerpentine(config.serpentine);
+            return ditherer;
+        }
         case DitherMethod::ORDERED:
             return std::make_unique<OrderedDithrer>(config.bayerSize);
         case DitherMethod::THRESHOLD:
             return std::make_unique<ThresholdDithrer>(config.threshold);
         case DitherMethod::ASCII:
             return std::make_unique<AsciiDithrer>(config.asciiCharSet, config.detectEdges);
+        case DitherMethod::DOT_DIFFUSION:
+            return std::make_unique<DotDiffusionDithrer>();
+        case DitherMethod::DOT_DIFFUSION_OPTIMIZED:
+            return std::make_unique<DotDiffusionDithrer>(DotClassMatrix::OPTIMIZED);
+        case DitherMethod::OSTROMOUKHOV: {
+            auto ditherer = std::make_unique<OstromoukhovDithrer>();
+            ditherer->setSerpentine(!config.raster);
+            return ditherer;
+        }
+        case DitherMethod::RIEMERSMA:
+            return std::make_unique<RiemersmaDithrer>();
+        case DitherMethod::BLUE_NOISE:
+            return std::make_unique<BlueNoiseDithrer>(config.noiseSize);
+        case DitherMethod::YLILUOMA:
+            return std::make_unique<YliluomaDithrer>();
+        case DitherMethod::HALFTONE:
+            return std::make_unique<HalftoneDithrer>(config.cellSize, config.cmyk ? HalftoneMode::CMYK : HalftoneMode::CHANNELS);
+        case DitherMethod::NOISE:
+            return std::make_unique<NoiseDithrer>(NoiseType::WHITE, config.seed);
+        case DitherMethod::TPDF_NOISE:
+            return std::make_unique<NoiseDithrer>(NoiseType::TRIANGULAR, config.seed);
         default:
             return std::make_unique<FloydDithrer>();
     }
@@ -146,6 +208,15 @@ bool parseArguments(int argc, char* argv[], Config& config) {
             else if (method == "ordered") config.method = DitherMethod::ORDERED;
                     else if (method == "threshold") config.method = DitherMethod::THRESHOLD;
         else if (method == "ascii") config.method = DitherMethod::ASCII;
+        else if (method == "dot") config.method = DitherMethod::DOT_DIFFUSION;
+        else if (method == "dotopt") config.method = DitherMethod::DOT_DIFFUSION_OPTIMIZED;
+        else if (method == "ostromoukhov") config.method = DitherMethod::OSTROMOUKHOV;
+        else if (method == "riemersma") config.method = DitherMethod::RIEMERSMA;
+        else if (method == "bluenoise") config.method = DitherMethod::BLUE_NOISE;
+        else if (method == "yliluoma") config.method = DitherMethod::YLILUOMA;
+        else if (method == "halftone") config.method = DitherMethod::HALFTONE;
+        else if (method == "noise") config.method = DitherMethod::NOISE;
+        else if (method == "tpdf") config.method = DitherMethod::TPDF_NOISE;
         else {
             std::cerr << "Error: Unknown method '" << method << "'\n";
             return false;
@@ -169,6 +240,20 @@ bool parseArguments(int argc, char* argv[], Config& config) {
             std::cerr << "Error: Unknown ASCII set '" << asciiSet << "'\n";
             return false;
         }
+    }
+    else if (arg == "-g" || arg == "--glyph-match") {
+        if (++i >= argc) {
+            std::cerr << "Error: Missing glyph match mode\n";
+            return false;
+        }
+        std::string mode = argv[i];
+        if (mode == "none") config.glyphMatching = GlyphMatching::NONE;
+        else if (mode == "hamming") config.glyphMatching = GlyphMatching::HAMMING;
+        else if (mode == "weighted") config.glyphMatching = GlyphMatching::WEIGHTED;
+        else {
+            std::cerr << "Error: Unknown glyph match mode '" << mode << "'\n";
+            return false;
+        }
     }
         else if (arg == "-p" || arg == "--palette") {
             if (++i >= argc) {
@@ -198,11 +283,43 @@ bool parseArguments(int argc, char* argv[], Config& config) {
                 return false;
             }
             config.bayerSize = std::stoi(argv[i]);
-            if (config.bayerSize < 1 || config.bayerSize > 4) {
-                std::cerr << "Error: Bayer size must be between 1 and 4\n";
+            if (config.bayerSize < 1 || config.bayerSize > 8) {
+                std::cerr << "Error: Bayer size must be between 1 and 8\n";
                 return false;
             }
         }
+        else if (arg == "-n" || arg == "--noise-size") {
+            if (++i >= argc) {
+                std::cerr << "Error: Missing noise size argument\n";
+                return false;
+            }
+            config.noiseSize = std::stoi(argv[i]);
+            if (config.noiseSize != 64 && config.noiseSize != 128 && config.noiseSize != 256) {
+                std::cerr << "Error: Noise size must be 64, 128 or 256\n";
+                return false;
+            }
+        }
+        else if (arg == "-c" || arg == "--cell") {
+            if (++i >= argc) {
+                std::cerr << "Error: Missing cell size argument\n";
+                return false;
+            }
+            config.cellSize = std::stof(argv[i]);
+            if (config.cellSize < 2.0f || config.cellSize > 24.0f) {
+                std::cerr << "Error: Cell size must be between 2 and 24\n";
+                return false;
+            }
+        }
+        else if (arg == "-k" || arg == "--cmyk") {
+            config.cmyk = true;
+        }
+        else if (arg == "-r" || arg == "--seed") {
+            if (++i >= argc) {
+                std::cerr << "Error: Missing seed argument\n";
+                return false;
+            }
+            config.seed = std::stoull(argv[i]);
+        }
         else if (arg == "-t" || arg == "--threshold") {
             if (++i >= argc) {
                 std::cerr << "Error: Missing threshold argument\n";
@@ -214,6 +331,12 @@ bool parseArguments(int argc, char* argv[], Config& config) {
                 return false;
             }
         }
+        else if (arg == "-s" || arg == "--serpentine") {
+            config.serpentine = true;
+        }
+        else if (arg == "-l" || arg == "--raster") {
+            config.raster = true;
+        }
         else if (arg == "-f" || arg == "--format") {
             if (++i >= argc) {
                 std::cerr << "Error: Missing format argument\n";
@@ -232,6 +355,17 @@ bool parseArguments(int argc, char* argv[], Config& config) {
                 return false;
             }
         }
+        else if (arg == "-j" || arg == "--threads") {
+            if (++i >= argc) {
+                std::cerr << "Error: Missing thread count argument\n";
+                return false;
+            }
+            config.threads = std::stoi(argv[i]);
+            if (config.threads < 0) {
+                std::cerr << "Error: Thread count must be 0 or more\n";
+                return false;
+            }
+        }
         else if (arg[0] == '-') {
             std::cerr << "Error: Unknown option '" << arg << "'\n";
             return false;
@@ -264,6 +398,7 @@ int main(int argc, char* argv[]) {
     if (!parseArguments(argc, argv, config)) {
         return 1;
     }
+    thread_pool::setThreadCount(config.threads);
     
     // Load input image
     Image inputImage(1, 1); // Temporary size, will be set by load()
@@ -281,6 +416,15 @@ int main(int argc, char* argv[]) {
         case DitherMethod::ORDERED: std::cout << "Ordered (Bayer " << (1 << config.bayerSize) << "x" << (1 << config.bayerSize) << ")"; break;
         case DitherMethod::THRESHOLD: std::cout << "Threshold (" << config.threshold << ")"; break;
         case DitherMethod::ASCII: std::cout << "ASCII"; break;
+        case DitherMethod::DOT_DIFFUSION: std::cout << "Dot Diffusion (Knuth)"; break;
+        case DitherMethod::DOT_DIFFUSION_OPTIMIZED: std::cout << "Dot Diffusion (optimized class matrix)"; break;
+        case DitherMethod::OSTROMOUKHOV: std::cout << "Ostromoukhov"; break;
+        case DitherMethod::RIEMERSMA: std::cout << "Riemersma (Hilbert curve)"; break;
+        case DitherMethod::BLUE_NOISE: std::cout << "Blue noise (" << config.noiseSize << "x" << config.noiseSize << ")"; break;
+        case DitherMethod::YLILUOMA: std::cout << "Yliluoma pattern"; break;
+        case DitherMethod::HALFTONE: std::cout << "Halftone (" << config.cellSize << "px cells" << (config.cmyk ? ", CMYK" : "") << ")"; break;
+        case DitherMethod::NOISE: std::cout << "White noise (seed " << config.seed << ")"; break;
+        case DitherMethod::TPDF_NOISE: std::cout << "Triangular noise (seed " << config.seed << ")"; break;
     }
     std::cout << "\n";
     
@@ -293,11 +437,14 @@ int main(int argc, char* argv[]) {
         case PaletteType::NES: std::cout << "NES"; break;
         case PaletteType::CGA: std::cout << "CGA"; break;
     }
-    std::cout << "\n\n";
+    std::cout << "\n";
+    std::cout << "Threads: " << thread_pool::threadCount() << "\n";
+    std::cout << "SIMD: " << cpu_dispatch::isaName(cpu_dispatch::activeIsa()) << "\n\n";
     
     // Handle ASCII dithering specially
     if (config.method == DitherMethod::ASCII) {
         auto asciiDitherer = std::make_unique<AsciiDithrer>(config.asciiCharSet, config.detectEdges);
+        asciiDitherer->setGlyphMatching(config.glyphMatching);
         if (!asciiDitherer->saveAsText(inputImage, config.outputFile)) {
             std::cerr << "Error: Failed to save ASCII art to '" << config.outputFile << "'\n";
             return 1;
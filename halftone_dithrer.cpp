@@ -0,0 +1,172 @@
+//
+// Created by Dhruva Sharma on 18/2/25.
+//
+
+#include "headers/halftone_dithrer.h"
+#include "headers/channel_levels.h"
+#include "headers/gray_pipeline.h"
+#include "headers/ordered_kernels.h"
+#include "headers/thread_pool.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <numeric>
+
+namespace {
+
+constexpr double kPi = 3.14159265358979323846;
+
+// x % period for every column, so the inner loops only index
+std::vector<int> ColumnTable(int width, int period) {
+  std::vector<int> columns(width);
+  for (int x = 0, column = 0; x < width; ++x) {
+    columns[x] = column;
+    if (++column == period) column = 0;
+  }
+  return columns;
+}
+
+}
+
+HalftoneDithrer::HalftoneDithrer(float cellSize, HalftoneMode mode, std::array<float, 4> angles) : mode_(mode) {
+  // Larger cells make the rational-tangent tiles (up to 2 * cellSize^2 wide) expensive
+  cellSize = std::max(2.0f, std::min(24.0f, cellSize));
+  for (int i = 0; i < 4; ++i) screens_[i] = BuildScreen(cellSize, angles[i]);
+}
+
+HalftoneDithrer::Screen HalftoneDithrer::BuildScreen(float cellSize, float angle) {
+  double radians = angle * kPi / 180.0;
+  int a = static_cast<int>(std::lround(cellSize * std::cos(radians)));
+  int b = static_cast<int>(std::lround(cellSize * std::sin(radians)));
+  if (a == 0 && b == 0) a = 1;
+  int norm = a * a + b * b;
+  int period = norm / std::gcd(std::abs(a), std::abs(b));
+  int cells = period * period;
+
+  // Round-dot spot function in screen coordinates, highest at the lattice points so the dark
+  // dots grow from there and the light ones from the cell centres
+  std::vector<double> spot(cells);
+  for (int y = 0; y < period; ++y) {
+    for (int x = 0; x < period; ++x) {
+      double px = x + 0.5, py = y + 0.5;
+      double u = (px * a + py * b) / norm;
+      double v = (py * a - px * b) / norm;
+      spot[y * period + x] = std::cos(2.0 * kPi * u) + std::cos(2.0 * kPi * v);
+    }
+  }
+
+  // Ranking turns the spot values into evenly spread thresholds: a linear tone response
+  std::vector<int> order(cells);
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&](int i, int j) { return spot[i] < spot[j]; });
+
+  Screen screen;
+  screen.period = period;
+  screen.thresholds.resize(cells);
+  screen.levels.resize(cells);
+  for (int rank = 0; rank < cells; ++rank) {
+    float threshold = (rank + 0.5f) / cells;
+    screen.thresholds[order[rank]] = threshold;
+    screen.levels[order[rank]] = static_cast<unsigned char>(threshold * 255.0f);
+  }
+  return screen;
+}
+
+void HalftoneDithrer::applyDither(const Image& inputImage, Image& outputImage, const Pallete& pallete) {
+  int width = inputImage.getWidth();
+  int height = inputImage.getHeight();
+
+  if (mode_ == HalftoneMode::CMYK) {
+    std::vector<int> columns[4];
+    for (int i = 0; i < 4; ++i) columns[i] = ColumnTable(width, screens_[i].period);
+    outputImage = Image(width, height);
+    thread_pool::parallelFor(0, height, 0, [&](int first, int last) {
+      for (int y = first; y < last; ++y) {
+        const Color* in = inputImage.getRow(y);
+        Color* out = outputImage.getRow(y);
+        const float* rows[4];
+        for (int i = 0; i < 4; ++i) {
+          rows[i] = screens_[i].thresholds.data() + static_cast<size_t>(y % screens_[i].period) * screens_[i].period;
+        }
+        for (int x = 0; x < width; ++x) {
+          Color color = in[x].Clamped();
+          // Simple separation with full black generation
+          float k = 1.0f - std::max(color.r, std::max(color.g, color.b));
+          float cover = 1.0f - k;
+          float ink[4] = {0.0f, 0.0f, 0.0f, k};
+          if (cover > 0.0f) {
+            ink[0] = (cover - color.r) / cover;
+            ink[1] = (cover - color.g) / cover;
+            ink[2] = (cover - color.b) / cover;
+          }
+          // An ink prints where the paper left by it would fall under the screen threshold
+          bool on[4];
+          for (int i = 0; i < 4; ++i) on[i] = !(1.0f - ink[i] > rows[i][columns[i][x]]);
+          out[x] = on[3] ? Color(0.0f, 0.0f, 0.0f)
+                         : Color(on[0] ? 0.0f : 1.0f, on[1] ? 0.0f : 1.0f, on[2] ? 0.0f : 1.0f);
+        }
+      }
+    });
+    return;
+  }
+
+  if (gray_pipeline::canUse(pallete)) {
+    const Screen& screen = screens_[3];
+    std::vector<unsigned char> gray = gray_pipeline::decodeGray8(inputImage);
+    gray_pipeline::GrayLevels levels(pallete);
+    std::vector<unsigned char> indices(gray.size());
+    ordered_kernels::UniformRamp ramp;
+    if (ordered_kernels::uniformRamp(levels, ramp)) {
+      // Unroll each tile row across the image so the row kernel can run unmodified
+      int rowWidth = ordered_kernels::kRowAlign;
+      while (rowWidth < width) rowWidth *= 2;
+      std::vector<unsigned char> rows(static_cast<size_t>(screen.period) * rowWidth);
+      std::vector<int> columns = ColumnTable(width, screen.period);
+      for (int ty = 0; ty < screen.period; ++ty) {
+        unsigned char* row = rows.data() + static_cast<size_t>(ty) * rowWidth;
+        for (int x = 0; x < width; ++x) row[x] = screen.levels[ty * screen.period + columns[x]];
+      }
+      thread_pool::parallelFor(0, height, 0, [&](int first, int last) {
+        for (int y = first; y < last; ++y) {
+          size_t offset = static_cast<size_t>(y) * width;
+          const unsigned char* thresholds = rows.data() + static_cast<size_t>(y % screen.period) * rowWidth;
+          ordered_kernels::ditherRow(gray.data() + offset, thresholds, rowWidth, indices.data() + offset, width, ramp);
+        }
+      });
+    } else {
+      std::vector<int> columns = ColumnTable(width, screen.period);
+      thread_pool::parallelFor(0, height, 0, [&](int first, int last) {
+        for (int y = first; y < last; ++y) {
+          const unsigned char* in = gray.data() + static_cast<size_t>(y) * width;
+          unsigned char* out = indices.data() + static_cast<size_t>(y) * width;
+          const float* thresholds = screen.thresholds.data() + static_cast<size_t>(y % screen.period) * screen.period;
+          for (int x = 0; x < width; ++x) {
+            const gray_pipeline::GrayLevels::Step& step = levels.step(in[x]);
+            out[x] = step.fraction > thresholds[columns[x]] ? step.upper : step.lower;
+          }
+        }
+      });
+    }
+    gray_pipeline::emitIndices(indices, width, height, pallete, outputImage);
+    return;
+  }
+
+  outputImage = inputImage;
+  ChannelLevels levels(pallete);
+  std::vector<int> columns[3];
+  for (int i = 0; i < 3; ++i) columns[i] = ColumnTable(width, screens_[i].period);
+  thread_pool::parallelFor(0, height, 0, [&](int first, int last) {
+    for (int y = first; y < last; ++y) {
+      const Color* in = inputImage.getRow(y);
+      Color* out = outputImage.getRow(y);
+      const float* rows[3];
+      for (int i = 0; i < 3; ++i) {
+        rows[i] = screens_[i].thresholds.data() + static_cast<size_t>(y % screens_[i].period) * screens_[i].period;
+      }
+      for (int x = 0; x < width; ++x) {
+        out[x] = levels.spread(in[x], rows[0][columns[0][x]], rows[1][columns[1][x]], rows[2][columns[2][x]]);
+      }
+      pallete.GetClosestColors(out, out, width);
+    }
+  });
+}
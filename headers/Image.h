@@ -5,6 +5,7 @@
 #ifndef IMAGE_H
 #define IMAGE_H
 
+#include <string>
 #include <vector>
 #include "color.h"
 
@@ -18,10 +19,17 @@ class Image {
 
     bool load(const std::string& filename);
     bool save(const std::string& filename, const std::string& format);
+    // Writes width x height RGBA8 pixels, for output rendered straight to bytes
+    static bool saveRgba8(const std::string& filename, const std::string& format, const unsigned char* data,
+                          int width, int height);
 
     Color getPixel(int x, int y) const;
     void setPixel(int x, int y, const Color& color);
 
+    // Direct access to a row of pixels, for inner loops that walk whole rows
+    const Color* getRow(int y) const;
+    Color* getRow(int y);
+
     int getWidth() const;
     int getHeight() const;
 
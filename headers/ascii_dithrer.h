@@ -2,6 +2,9 @@
 #define ASCII_DITHRER_H
 
 #include "dithrer.h"
+#include "glyph_match.h"
+#include "glyph_ramps.h"
+#include "summed_area_table.h"
 #include <string>
 #include <vector>
 #include <fstream>
@@ -41,6 +44,12 @@ enum class DepthMode {
     GAUSSIAN        // Gaussian depth fade
 };
 
+enum class GlyphMatching {
+    NONE,           // Characters by brightness and edge direction
+    HAMMING,        // Glyph nearest to the tile's 8x8 shape (XOR + popcount)
+    WEIGHTED        // Same, with mismatches far from the tile's threshold costing more
+};
+
 struct TileInfo {
     float averageLuminance;
     EdgeDirection dominantEdge;
@@ -48,8 +57,13 @@ struct TileInfo {
     int edgePixelCount;
     float depth;
     bool hasSignificantEdges;
+    bool hasShape;                  // false when glyph matching is off or the tile is too flat
+    glyph_match::TileMask shape;
 };
 
+// The save methods only read the settings; everything they derive from an image lives in a Frame
+// of their own. One configured ditherer can therefore serve several threads at once, as long as
+// nothing calls a setter meanwhile.
 class AsciiDithrer : public Dither {
 public:
     AsciiDithrer(AsciiCharSet charSet = AsciiCharSet::FONT8X8, bool detectEdges = true);
@@ -58,16 +72,22 @@ public:
     void applyDither(const Image& inputImage, Image& outputImage, const Pallete& pallete) override;
     
     // Save as text file
-    bool saveAsText(const Image& inputImage, const std::string& filename);
+    bool saveAsText(const Image& inputImage, const std::string& filename) const;
     
     // Save as advanced text file (uses advanced tile/edge/character logic)
-    bool saveAsTextAdvanced(const Image& inputImage, const std::string& filename);
+    bool saveAsTextAdvanced(const Image& inputImage, const std::string& filename) const;
     
     // Save as simplified text file (specific characters + Gaussian blur)
-    bool saveAsTextSimplified(const Image& inputImage, const std::string& filename);
+    bool saveAsTextSimplified(const Image& inputImage, const std::string& filename) const;
+    
+    // The same text in a string, for callers that do not want a file (e.g. the web server). Each
+    // save writes the whole file in one call.
+    bool renderAsText(const Image& inputImage, std::string& text) const;
+    bool renderAsTextAdvanced(const Image& inputImage, std::string& text) const;
+    bool renderAsTextSimplified(const Image& inputImage, std::string& text) const;
     
     // Save as image (true tile-based ASCII art)
-    bool saveAsAsciiImage(const Image& inputImage, const std::string& filename, const Color& fg, const Color& bg, int scale = 1);
+    bool saveAsAsciiImage(const Image& inputImage, const std::string& filename, const Color& fg, const Color& bg, int scale = 1) const;
     
     // Enhanced settings
     void setEdgeThreshold(float threshold) { edgeThreshold_ = threshold; }
@@ -78,6 +98,9 @@ public:
     void setDogSigmaScale(float scale) { dogSigmaScale_ = scale; }
     void setDogTau(float tau) { dogTau_ = tau; }
     void setDogThreshold(float threshold) { dogThreshold_ = threshold; }
+    // Take tile edges from the Sobel of the DoG (the setDog* settings above) instead of the
+    // luminance gradient; off by default
+    void setDogEdges(bool enabled) { dogEdges_ = enabled; }
     void setEdgePixelThreshold(int threshold) { edgePixelThreshold_ = threshold; }
     
     // New advanced settings
@@ -86,16 +109,19 @@ public:
     void setDepthThreshold(float threshold) { depthThreshold_ = threshold; }
     void setDepthFade(float fade) { depthFade_ = fade; }
     void setBloomIntensity(float intensity) { bloomIntensity_ = intensity; }
+    void setBloomSigma(float sigma) { bloomSigma_ = sigma; }  // glow spread, in output pixels
     void setColorBurn(float burn) { colorBurn_ = burn; }
     void setToneMapping(float mapping) { toneMapping_ = mapping; }
     void setLowContrast(bool lowContrast) { lowContrast_ = lowContrast; }
     void setTileSize(int size) { tileSize_ = size; }
     void setComputeShaderMode(bool enabled) { computeShaderMode_ = enabled; }
+    void setGlyphMatching(GlyphMatching mode) { glyphMatching_ = mode; }
     
 private:
     AsciiCharSet charSet_;
     bool detectEdges_;
-    std::string charMap_;
+    const glyph_ramps::Ramp* ramp_;  // of charSet_
+    const glyph_ramps::Candidates* shapes_;  // for glyph matching, of charSet_
     float edgeThreshold_;
     float contrast_;
     float brightness_;
@@ -104,6 +130,7 @@ private:
     float dogSigmaScale_;
     float dogTau_;
     float dogThreshold_;
+    bool dogEdges_;
     int edgePixelThreshold_;
     
     // New advanced parameters
@@ -112,61 +139,74 @@ private:
     float depthThreshold_;
     float depthFade_;
     float bloomIntensity_;
+    float bloomSigma_;
     float colorBurn_;
     float toneMapping_;
     bool lowContrast_;
     int tileSize_;
     bool computeShaderMode_;
+    GlyphMatching glyphMatching_;
     
-    // Advanced edge detection
-    std::vector<float> luminanceBuffer_;
-    std::vector<float> dogBuffer_;
-    std::vector<float> edgeBuffer_;
-    std::vector<EdgeDirection> edgeDirectionBuffer_;
-    std::vector<TileInfo> tileBuffer_;
-    
-    // Font8x8 data
-    static const unsigned char font8x8_basic[128][8];
-    static const unsigned char font8x8_block[32][8];
+    // Per-call scratch: an image's luminance and what is derived from it
+    struct Frame {
+        int width = 0;
+        int height = 0;
+        std::vector<float> luminance;
+        SummedAreaTable luminanceTable;  // of luminance, for O(1) tile statistics
+        std::vector<float> dog;  // with dogEdges_ only
+        // Sobel magnitude / 1020 of luminance and the orientation of every pixel above
+        // edgeThreshold_ (NONE elsewhere), or with dogEdges_ the Sobel magnitude of dog and the
+        // orientation above dogThreshold_; analyzeTile only reduces over these
+        std::vector<float> edgeStrength;
+        std::vector<EdgeDirection> edgeOrientation;
+        int tilesX = 0;
+        int tilesY = 0;
+        std::vector<TileInfo> tiles;
+    };
     
     void initializeCharMap();
-    float getBrightness(const Color& color);
-    char brightnessToChar(float brightness, bool isEdge = false);
-    char getDirectionalChar(float brightness, EdgeDirection direction);
-    bool isEdgePixel(const Image& image, int x, int y);
-    float calculateEdgeStrength(const Image& image, int x, int y);
-    float applyImageProcessing(float value);
+    float getBrightness(const Color& color) const;
+    char32_t brightnessToChar(float brightness, bool isEdge = false) const;
+    char32_t getDirectionalChar(float brightness, EdgeDirection direction) const;
+    float applyImageProcessing(float value) const;
     char getShaderOptimizedChar(float brightness, float edgeStrength);
     
     // Advanced edge detection methods
-    void calculateLuminanceBuffer(const Image& image);
-    void applyDifferenceOfGaussians();
-    void applySobelFilter();
+    void calculateLuminanceBuffer(const Image& image, Frame& frame) const;
+    // With dogEdges_: the DoG of the luminance, and the edge fields from a Sobel over it
+    void applyDifferenceOfGaussians(Frame& frame) const;
+    void applySobelFilter(Frame& frame) const;
+    void calculateGradientField(Frame& frame) const;
     void detectEdgeDirections();
-    EdgeDirection getEdgeDirection(float theta);
-    float gaussian(float sigma, float pos);
-    void horizontalBlur(std::vector<float>& input, std::vector<float>& output, int width, int height);
-    void verticalBlur(std::vector<float>& input, std::vector<float>& output, int width, int height);
-    char getAdvancedChar(int x, int y, float brightness, EdgeDirection direction);
+    EdgeDirection getEdgeDirection(float theta) const;
+    char getAdvancedChar(int x, int y, float brightness, EdgeDirection direction) const;
     
     // Font8x8 methods
     char getFont8x8Char(float brightness, EdgeDirection direction);
-    void renderFont8x8Tile(std::ofstream& file, char asciiChar);
-    float getFont8x8Density(const char* fontData);
-    char selectFont8x8Char(float brightness);
+    void renderFont8x8Row(char32_t glyph, int row, char* out) const;
+    char selectFont8x8Char(float brightness) const;
     
     // New advanced methods
-    void processTiles(const Image& image);
-    TileInfo analyzeTile(const Image& image, int tileX, int tileY);
-    EdgeDirection getDominantEdgeDirection(const std::vector<EdgeDirection>& directions);
-    char selectTileCharacter(const TileInfo& tile);
-    Color applyColorTheme(const Color& original, float luminance, float depth);
-    float calculateDepthEffect(float depth);
-    void applyBloomEffect(std::vector<Color>& colors, int width, int height);
-    void applyColorBurnEffect(std::vector<Color>& colors);
-    void applyToneMapping(std::vector<Color>& colors);
-    void applyLowContrastEffect(std::vector<Color>& colors);
-    Color getThemeColor(float luminance, float depth);
+    // Luminance, edge fields (with detectEdges_) and every tile of frame, in parallel
+    void processTiles(const Image& image, Frame& frame) const;
+    TileInfo analyzeTile(const Frame& frame, int tileX, int tileY) const;
+    // counts: edge pixels per direction, indexed by EdgeDirection
+    EdgeDirection getDominantEdgeDirection(const int* counts) const;
+    char32_t selectTileCharacter(const TileInfo& tile) const;
+    // The character of each of frame's tiles, in parallel
+    std::vector<char32_t> selectTileCharacters(const Frame& frame) const;
+    // Binarizes [x0, x1) x [y0, y1) of frame's luminance as 8x8 cells around their mean; false if
+    // the tile has too little contrast to have a shape
+    bool tileShape(const Frame& frame, int x0, int y0, int x1, int y1, glyph_match::TileMask& shape) const;
+    // The glyph of shapes_ nearest to shape
+    char32_t matchGlyph(const glyph_match::TileMask& shape) const;
+    Color applyColorTheme(const Color& original, float luminance, float depth) const;
+    float calculateDepthEffect(float depth) const;
+    void applyBloomEffect(std::vector<Color>& colors, int width, int height) const;
+    void applyColorBurnEffect(std::vector<Color>& colors) const;
+    void applyToneMapping(std::vector<Color>& colors) const;
+    void applyLowContrastEffect(std::vector<Color>& colors) const;
+    Color getThemeColor(float luminance, float depth) const;
 };
 
 #endif // ASCII_DITHRER_H 
\ No newline at end of file
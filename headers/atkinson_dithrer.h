@@ -7,9 +7,6 @@ class AtkinsonDithrer : public ErrorDiffusionDithrer {
 public:
     AtkinsonDithrer();
     ~AtkinsonDithrer() override = default;
-    void applyDither(const Image& inputImage, Image& outputImage, const Pallete& pallete) override;
-protected:
-    void DistributeError(Image& image, int x, int y, const Color& error) override;
 };
 
-#endif // ATKINSON_DITHRER_H 
\ No newline at end of file
+#endif // ATKINSON_DITHRER_H 
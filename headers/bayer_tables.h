@@ -0,0 +1,40 @@
+//
+// Created by Dhruva Sharma on 18/2/25.
+//
+
+#ifndef BAYER_TABLES_H
+#define BAYER_TABLES_H
+
+// Bayer threshold matrices from 2x2 (order 1) to 256x256 (order 8), generated at compile time.
+// Each order has a flat float table of (rank + 0.5) / cells and an 8-bit table of
+// floor(threshold * 255) whose rows are repeated to at least 64 bytes for the row kernels.
+namespace bayer_tables {
+
+constexpr int kMinOrder = 1;
+constexpr int kMaxOrder = 8;
+
+// Rank of (x, y) in the 2^order matrix. The top-level quadrant is the least significant base-4
+// digit (0 top-left, 1 top-right, 2 bottom-left, 3 bottom-right), and so on down to single cells.
+constexpr int rank(int order, int x, int y) {
+    int value = 0;
+    for (int i = 0; i < order; ++i) {
+        int bit = order - 1 - i;
+        int quadrant = ((x >> bit) & 1) + 2 * ((y >> bit) & 1);
+        value += quadrant << (2 * i);
+    }
+    return value;
+}
+
+struct View {
+    int size;                     // matrix width and height
+    int width8;                   // bytes per row of levels, max(size, 64)
+    const float* thresholds;      // size x size
+    const unsigned char* levels;  // size x width8
+};
+
+// Tables for an order clamped to [kMinOrder, kMaxOrder]
+View view(int order);
+
+}
+
+#endif //BAYER_TABLES_H
@@ -0,0 +1,27 @@
+//
+// Created by Dhruva Sharma on 18/2/25.
+//
+
+#ifndef BLUE_NOISE_H
+#define BLUE_NOISE_H
+
+#include <cstdint>
+#include <vector>
+
+// Tileable blue-noise threshold masks built with Ulichney's void-and-cluster method.
+// Generation is expensive, so masks are kept per process and cached on disk under
+// $DITHERBOY_CACHE_DIR (or $XDG_CACHE_HOME/ditherboy, ~/.cache/ditherboy, the temp dir).
+namespace blue_noise {
+
+// Mask sizes that can be generated; anything else is rounded to the nearest of these
+int supportedSize(int size);
+
+// Rank of every cell of a size x size mask (a permutation of 0 .. size*size-1)
+std::vector<uint16_t> generateRanks(int size);
+
+// Thresholds in (0, 1), row-major, (rank + 0.5) / cells. Loaded or generated once per size.
+const std::vector<float>& thresholdMap(int size);
+
+}
+
+#endif //BLUE_NOISE_H
@@ -0,0 +1,27 @@
+//
+// Created by Dhruva Sharma on 18/2/25.
+//
+
+#ifndef BLUE_NOISE_DITHRER_H
+#define BLUE_NOISE_DITHRER_H
+
+#include "dithrer.h"
+#include "ordered_kernels.h"
+#include <vector>
+
+// Ordered dithering against a tileable void-and-cluster blue-noise mask instead of a Bayer
+// matrix. The mask comes from blue_noise::thresholdMap, so it is generated at most once per size.
+class BlueNoiseDithrer : public Dither {
+  public:
+    BlueNoiseDithrer(int size = 64);
+    ~BlueNoiseDithrer() override = default;
+
+    void applyDither(const Image& inputImage, Image& outputImage, const Pallete& pallete) override;
+
+  private:
+    int size_;
+    const std::vector<float>* thresholds_;
+    ordered_kernels::ThresholdTile tile_;
+};
+
+#endif //BLUE_NOISE_DITHRER_H
@@ -0,0 +1,46 @@
+//
+// Created by Dhruva Sharma on 18/2/25.
+//
+
+#ifndef CHANNEL_LEVELS_H
+#define CHANNEL_LEVELS_H
+
+#include <vector>
+#include "color.h"
+#include "pallete.h"
+
+// Per-channel levels of a palette, used to make ordered and threshold dithering palette-aware.
+// Instead of collapsing a pixel to black or white, each channel is moved inside the gap between
+// the palette levels around it so that the nearest palette color flips where the channel's
+// position in the gap crosses the threshold. Every palette entry stays reachable, and the
+// result only depends on the pixel and its threshold.
+class ChannelLevels {
+  public:
+    explicit ChannelLevels(const Pallete& pallete);
+
+    // Color to hand to GetClosestColor for a threshold in (0, 1)
+    Color spread(const Color& color, float threshold) const {
+      return Color(Spread(0, color.r, threshold), Spread(1, color.g, threshold),
+                   Spread(2, color.b, threshold));
+    }
+    // Same with a separate threshold per channel (e.g. screens at different angles)
+    Color spread(const Color& color, float thresholdR, float thresholdG, float thresholdB) const {
+      return Color(Spread(0, color.r, thresholdR), Spread(1, color.g, thresholdG),
+                   Spread(2, color.b, thresholdB));
+    }
+
+    // Each channel moved by `amount` times the gap between the levels around it, i.e. additive
+    // noise measured in quantization steps
+    Color offset(const Color& color, float amount) const {
+      return Color(color.r + amount * Gap(0, color.r), color.g + amount * Gap(1, color.g),
+                   color.b + amount * Gap(2, color.b));
+    }
+
+  private:
+    std::vector<float> levels_[3];  // ascending, duplicates removed
+
+    float Spread(int channel, float value, float threshold) const;
+    float Gap(int channel, float value) const;
+};
+
+#endif //CHANNEL_LEVELS_H
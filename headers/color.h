@@ -5,19 +5,46 @@
 #ifndef COLOR_H
 #define COLOR_H
 
+#include <algorithm>
+
+// Defined inline so the per-pixel math folds into the dithering loops of every translation unit;
+// color_simd.h has the same operations on 128-bit registers for the hottest of those loops.
 struct Color {
   float r, g, b, a;
-  Color();
-  Color(float r, float g, float b, float a);
-  Color(float r, float g, float b);
+  constexpr Color() : r(0.0f), g(0.0f), b(0.0f), a(1.0f) {} // black opaque
+  constexpr Color(float r, float g, float b, float a) : r(r), g(g), b(b), a(a) {}
+  constexpr Color(float r, float g, float b) : r(r), g(g), b(b), a(1.0f) {}
+
+  constexpr Color Clamped() const {
+    return Color(Clamp01(r), Clamp01(g), Clamp01(b), Clamp01(a));
+  }
 
-  Color Clamped();
-  
   // Arithmetic operators
-  Color operator-(const Color& other) const;
-  Color operator+(const Color& other) const;
-  Color operator*(float scalar) const;
+  constexpr Color operator-(const Color& other) const {
+    return Color(r - other.r, g - other.g, b - other.b, a - other.a);
+  }
+  constexpr Color operator+(const Color& other) const {
+    return Color(r + other.r, g + other.g, b + other.b, a + other.a);
+  }
+  constexpr Color operator*(float scalar) const {
+    return Color(r * scalar, g * scalar, b * scalar, a * scalar);
+  }
+
+  // RGB-only variants: alpha is carried over from this color untouched
+  constexpr Color ClampedRgb() const { return Color(Clamp01(r), Clamp01(g), Clamp01(b), a); }
+  constexpr Color AddRgb(const Color& other) const {
+    return Color(r + other.r, g + other.g, b + other.b, a);
+  }
+  constexpr Color SubtractRgb(const Color& other) const {
+    return Color(r - other.r, g - other.g, b - other.b, a);
+  }
+  constexpr Color ScaleRgb(float scalar) const { return Color(r * scalar, g * scalar, b * scalar, a); }
+
+  private:
+    static constexpr float Clamp01(float value) { return std::max(0.0f, std::min(1.0f, value)); }
 };
 
+static_assert(sizeof(Color) == 4 * sizeof(float), "Color is read as four packed floats");
+
 
 #endif //COLOR_H
@@ -0,0 +1,88 @@
+//
+// Created by Dhruva Sharma on 18/2/25.
+//
+
+#ifndef COLOR_SIMD_H
+#define COLOR_SIMD_H
+
+#include "color.h"
+
+// SSE2 is part of every x86-64 CPU (and MSVC's default on 32-bit x86), so unlike the kernels in
+// cpu_dispatch.h these need no runtime check
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define COLOR_SIMD_SSE2 1
+#endif
+
+// A pixel as one 128-bit register (r, g, b, a in lanes 0-3). Each lane does exactly what the
+// matching Color operator does to that channel, so both give the same bits.
+namespace color_simd {
+
+#ifdef COLOR_SIMD_SSE2
+
+struct Pixel {
+  __m128 v;
+};
+
+inline Pixel load(const Color& color) { return {_mm_loadu_ps(&color.r)}; }
+inline Pixel load(const float* values) { return {_mm_loadu_ps(values)}; }
+inline void store(Color& color, Pixel p) { _mm_storeu_ps(&color.r, p.v); }
+inline void store(float* values, Pixel p) { _mm_storeu_ps(values, p.v); }
+inline Pixel splat(float value) { return {_mm_set1_ps(value)}; }
+
+inline Pixel operator+(Pixel x, Pixel y) { return {_mm_add_ps(x.v, y.v)}; }
+inline Pixel operator-(Pixel x, Pixel y) { return {_mm_sub_ps(x.v, y.v)}; }
+inline Pixel operator*(Pixel x, float scalar) { return {_mm_mul_ps(x.v, _mm_set1_ps(scalar))}; }
+
+// max(0, min(1, v)) per lane; min_ps returns its second operand for NaN, as std::min(1.0f, v) does
+inline Pixel clamped(Pixel p) {
+  return {_mm_max_ps(_mm_min_ps(p.v, _mm_set1_ps(1.0f)), _mm_setzero_ps())};
+}
+
+// Alpha lane zeroed, e.g. for an RGB error vector
+inline Pixel rgb(Pixel p) {
+  return {_mm_and_ps(p.v, _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0)))};
+}
+
+#else
+
+struct Pixel {
+  float v[4];
+};
+
+inline Pixel load(const Color& color) { return {{color.r, color.g, color.b, color.a}}; }
+inline Pixel load(const float* values) { return {{values[0], values[1], values[2], values[3]}}; }
+inline void store(Color& color, Pixel p) { color = Color(p.v[0], p.v[1], p.v[2], p.v[3]); }
+inline void store(float* values, Pixel p) {
+  for (int i = 0; i < 4; ++i) values[i] = p.v[i];
+}
+inline Pixel splat(float value) { return {{value, value, value, value}}; }
+
+inline Pixel operator+(Pixel x, Pixel y) {
+  return {{x.v[0] + y.v[0], x.v[1] + y.v[1], x.v[2] + y.v[2], x.v[3] + y.v[3]}};
+}
+inline Pixel operator-(Pixel x, Pixel y) {
+  return {{x.v[0] - y.v[0], x.v[1] - y.v[1], x.v[2] - y.v[2], x.v[3] - y.v[3]}};
+}
+inline Pixel operator*(Pixel x, float scalar) {
+  return {{x.v[0] * scalar, x.v[1] * scalar, x.v[2] * scalar, x.v[3] * scalar}};
+}
+
+inline Pixel clamped(Pixel p) {
+  Color color(p.v[0], p.v[1], p.v[2], p.v[3]);
+  return load(color.Clamped());
+}
+
+inline Pixel rgb(Pixel p) { return {{p.v[0], p.v[1], p.v[2], 0.0f}}; }
+
+#endif
+
+inline Color toColor(Pixel p) {
+  Color color;
+  store(color, p);
+  return color;
+}
+
+}
+
+#endif //COLOR_SIMD_H
@@ -0,0 +1,47 @@
+//
+// Created by Dhruva Sharma on 18/2/25.
+//
+
+#ifndef CPU_DISPATCH_H
+#define CPU_DISPATCH_H
+
+// The build targets baseline x86-64 (no arch flags), so one binary runs on every machine.
+// SIMD kernels are compiled per function with target attributes and bound once, on first use,
+// to the best variant the CPU supports. Other compilers and architectures get the scalar kernels.
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define CPU_DISPATCH_X86 1
+#endif
+
+#ifdef CPU_DISPATCH_X86
+// GCC 12's AVX-512 headers start some intrinsics from a deliberately undefined register and
+// trip -Wuninitialized wherever they are inlined (GCC bug 105593)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#include <immintrin.h>
+#pragma GCC diagnostic pop
+#endif
+
+namespace cpu_dispatch {
+
+// Ordered from least to most capable; AVX512 stands for AVX-512 F + BW
+enum class Isa {
+    SCALAR,
+    SSE42,
+    AVX2,
+    AVX512
+};
+
+// The best instruction set of this CPU, detected once
+Isa detectedIsa();
+
+// What the kernels bind to: detectedIsa(), or DITHERBOY_FORCE_ISA (scalar, sse4.2, avx2, avx512)
+// when set, so every path can be exercised on one machine. Requests above what the CPU supports
+// fall back to detectedIsa() with a warning.
+Isa activeIsa();
+
+const char* isaName(Isa isa);
+
+}
+
+#endif //CPU_DISPATCH_H
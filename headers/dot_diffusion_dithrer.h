@@ -0,0 +1,50 @@
+//
+// Created by Dhruva Sharma on 18/2/25.
+//
+
+#ifndef DOT_DIFFUSION_DITHRER_H
+#define DOT_DIFFUSION_DITHRER_H
+
+#include "dithrer.h"
+#include <vector>
+
+enum class DotClassMatrix {
+  KNUTH,      // Knuth's 8x8 matrix with two barons
+  OPTIMIZED   // 8x8 matrix searched for the least low-frequency error (see dot_diffusion_dithrer.cpp)
+};
+
+// Knuth's dot diffusion: the image is tiled with a class matrix and pixels are quantized in
+// class order, pushing their error only to neighbors of a higher class. Each row of cells is a
+// band run through every class on its own; even bands go first and odd bands after, so pixels
+// on the edges of odd bands keep their error inside the band.
+class DotDiffusionDithrer : public Dither {
+  public:
+    // One of the bundled 8x8 class matrices
+    DotDiffusionDithrer(DotClassMatrix matrix = DotClassMatrix::KNUTH);
+    // Any square class matrix holding each class 0..size*size-1 exactly once (row-major)
+    DotDiffusionDithrer(const std::vector<int>& classMatrix, int size);
+    ~DotDiffusionDithrer() override = default;
+
+    void applyDither(const Image& inputImage, Image& outputImage, const Pallete& pallete) override;
+
+    struct Neighbor {
+      int dx;
+      int dy;
+      float weight;
+    };
+
+  private:
+    int size_;
+    std::vector<int> classMatrix_;
+    // Cell position (x + y * size_) of every class, in class order
+    std::vector<int> classOrder_;
+    // Higher-class neighbors of each cell position, weights normalized (orthogonal 2, diagonal 1)
+    std::vector<std::vector<Neighbor>> neighbors_;
+    // Same, leaving out neighbors in the rows of cells above and below (used by odd bands)
+    std::vector<std::vector<Neighbor>> innerNeighbors_;
+
+    void PrepareClasses();
+    std::vector<std::vector<Neighbor>> HigherNeighbors(bool insideBand) const;
+};
+
+#endif //DOT_DIFFUSION_DITHRER_H
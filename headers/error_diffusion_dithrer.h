@@ -6,14 +6,59 @@
 #define ERROR_DIFFUSION_DITHRER_H
 
 #include "dithrer.h"
+#include "gray_pipeline.h"
+#include <vector>
+
+// One weight of a diffusion kernel, relative to the pixel being quantized.
+struct DiffusionTap {
+    int dx;
+    int dy;
+    float weight;
+};
+
+// Progress of the rows being diffused concurrently (defined in error_diffusion_dithrer.cpp)
+struct DiffusionWavefront;
 
 class ErrorDiffusionDithrer : public Dither{
   public:
     ~ErrorDiffusionDithrer() override = default;
 
+    void applyDither(const Image& inputImage, Image& outputImage, const Pallete& pallete) override;
+
+    // Serpentine (boustrophedon) scanning: odd rows run right to left with the kernel mirrored.
+    void setSerpentine(bool serpentine) { serpentine_ = serpentine; }
+    bool isSerpentine() const { return serpentine_; }
+
   protected:
-    ErrorDiffusionDithrer() {}
-    virtual void DistributeError(Image& image, int x, int y, const Color& error) = 0;
+    ErrorDiffusionDithrer(std::vector<DiffusionTap> kernel);
+
+    // Kernels whose weights depend on the input level override this and set levelDependent_.
+    // Returns one weight per tap of kernel_ for an 8-bit level (mean of R, G and B).
+    virtual const float* KernelWeights(int level) const;
+
+    // Quantizes one row, reading and writing the error rows ring (ringRows rows of padded RGB floats).
+    // With a wavefront the row waits for the row above to get far enough ahead and reports its own progress.
+    void DiffuseRow(const Image& inputImage, Image& outputImage, const Pallete& pallete,
+                    std::vector<float>& errorRows, int ringRows, int y, DiffusionWavefront* wavefront) const;
+    // Same on the gray8 fast path: one float of error per pixel, palette indices out
+    void DiffuseRowGray(const std::vector<unsigned char>& gray, std::vector<unsigned char>& indices,
+                        const gray_pipeline::GrayLevels& levels, std::vector<float>& errorRows,
+                        int width, int ringRows, int y, DiffusionWavefront* wavefront) const;
+    // Waits until row y - 1 has finished the columns that pixels start to end of row y (in its scan
+    // order) read from or add to alongside it
+    void AwaitRowAbove(const DiffusionWavefront& wavefront, int y, int width, int start, int end) const;
+    // Offsets from a pixel's error slot to each tap in the ring, for row y's scan direction
+    std::vector<int> TapOffsets(int y, int stride, int channels, int ringRows) const;
+    // Rows diffused at once: 1 (a plain top-to-bottom pass) unless the thread pool has spare threads
+    int Lanes(int height) const;
+    int ScanDirection(int y) const { return (serpentine_ && (y & 1)) ? -1 : 1; }
+
+    std::vector<DiffusionTap> kernel_;
+    std::vector<float> weights_;
+    bool levelDependent_;
+    int maxDx_;
+    int maxDy_;
+    bool serpentine_;
 };
 
 #endif //ERROR_DIFFUSION_DITHRER_H
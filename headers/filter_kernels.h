@@ -0,0 +1,34 @@
+//
+// Created by Dhruva Sharma on 18/2/25.
+//
+
+#ifndef FILTER_KERNELS_H
+#define FILTER_KERNELS_H
+
+// Convolution kernels over float planes, bound through cpu_dispatch like pixel_kernels.
+// Each output sums its taps in kernel order, so every variant gives the same bits.
+namespace filter_kernels {
+
+// out[x] = sum of in[clamp(x - radius + k)] * weights[k] for k = 0 .. 2 * radius, divided by norm
+void blurRow(const float* in, float* out, int width, const float* weights, int radius, float norm);
+
+// Vertical pass of the same filter: rows[k] is the source row for tap k, already clamped
+void blurColumns(const float* const* rows, float* out, int width, const float* weights, int radius, float norm);
+
+// 3x3 Sobel gradients and magnitude for x = 1 .. width - 2; the border columns are left untouched
+void sobelRow(const float* above, const float* row, const float* below, int width,
+              float* gx, float* gy, float* magnitude);
+
+// Two blurs of one row in a single sweep, out1 with weights1 and out2 with weights2. The weights
+// are expected to sum to 1, so nothing is divided.
+void blurRowPair(const float* in, float* out1, float* out2, int width,
+                 const float* weights1, int radius1, const float* weights2, int radius2);
+
+// Vertical passes of both blurs, written straight out as their difference:
+// out[x] = (rows1 blurred by weights1) - tau * (rows2 blurred by weights2)
+void differenceColumns(const float* const* rows1, const float* const* rows2, float* out, int width,
+                       const float* weights1, int radius1, const float* weights2, int radius2, float tau);
+
+}
+
+#endif //FILTER_KERNELS_H
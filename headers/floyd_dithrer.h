@@ -12,11 +12,6 @@ class FloydDithrer : public ErrorDiffusionDithrer {
 public:
   FloydDithrer();
   ~FloydDithrer() override = default;
-
-  void applyDither(const Image& input_image, Image& output_image, const Pallete& palette) override;
-
-protected:
-  void DistributeError(Image& image, int x, int y, const Color& color) override;
 };
 
 
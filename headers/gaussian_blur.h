@@ -0,0 +1,34 @@
+//
+// Created by Dhruva Sharma on 18/2/25.
+//
+
+#ifndef GAUSSIAN_BLUR_H
+#define GAUSSIAN_BLUR_H
+
+#include <vector>
+
+// Separable Gaussian blur of float planes, shared by the ASCII DoG, text simplification and bloom.
+// Small sigmas use a truncated FIR kernel through filter_kernels, whose cost grows with the
+// radius; above kRecursiveSigma a recursive (Young - van Vliet) filter is cheaper, at a constant
+// cost per pixel whatever the sigma.
+namespace gaussian_blur {
+
+constexpr float kRecursiveSigma = 6.0f;
+// Columns per strip of a vertical pass, so the rows under the kernel stay cached between output rows
+constexpr int kStripWidth = 512;
+
+// exp(-k^2 / (2 sigma^2)) for k = -radius .. radius, radius = ceil(3 sigma), divided by their sum
+std::vector<float> taps(float sigma, int& radius);
+
+// in and out are width x height, row-major, and must not overlap. Edges are extended.
+void convolve(const float* in, float* out, int width, int height, const float* taps, int radius);
+void recursive(const float* in, float* out, int width, int height, float sigma);
+// convolve() with taps(sigma) up to kRecursiveSigma, recursive() above it
+void blur(const float* in, float* out, int width, int height, float sigma);
+// blur(sigma1) - tau * blur(sigma2). Up to kRecursiveSigma both horizontal blurs share one sweep of
+// each row and the vertical passes write the difference directly.
+void difference(const float* in, float* out, int width, int height, float sigma1, float sigma2, float tau);
+
+}
+
+#endif //GAUSSIAN_BLUR_H
@@ -0,0 +1,67 @@
+//
+// Created by Dhruva Sharma on 18/2/25.
+//
+
+#ifndef GLYPH_BLIT_H
+#define GLYPH_BLIT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+// Rendering of font8x8 glyphs into an RGBA8 frame. Each (glyph, foreground, background) is
+// rasterized once, at the cache's cell size and scale, into a tile of packed pixels; drawing it is
+// then a memcpy per output row. Colors are RGBA bytes packed in memory order, as they go to
+// stb_image_write.
+namespace glyph_blit {
+
+// The four bytes of an RGBA8 pixel as one word
+uint32_t pack(const unsigned char* rgba);
+
+// count pixels of color from out on
+void fill(unsigned char* out, int count, uint32_t color);
+
+class TileCache {
+  public:
+    // A cell is cellSize x cellSize glyph pixels, each drawn as scale x scale output pixels. A
+    // glyph covers the top left 8 x 8 of a larger cell; the rest is background.
+    TileCache(int cellSize, int scale);
+
+    // Output pixels per tile row and column
+    int size() const { return size_; }
+
+    // The size() x size() RGBA8 tile of the glyph with these 8 row bytes, rasterized on first use.
+    // Valid until the next call.
+    const unsigned char* tile(const unsigned char* rows, uint32_t fg, uint32_t bg);
+
+    // tile's rows into frame, which is frameWidth pixels wide, with its top left at (x, y)
+    void blit(const unsigned char* tile, unsigned char* frame, int frameWidth, int x, int y) const;
+
+  private:
+    struct Key {
+        const unsigned char* rows;
+        uint32_t fg;
+        uint32_t bg;
+        bool operator==(const Key& other) const { return rows == other.rows && fg == other.fg && bg == other.bg; }
+    };
+    struct KeyHash {
+        std::size_t operator()(const Key& key) const;
+    };
+
+    void Rasterize(const unsigned char* rows, uint32_t fg, uint32_t bg, unsigned char* out) const;
+
+    // Past this many tiles the cache starts over, so themed output, where nearly every tile has a
+    // foreground of its own, does not grow it without bound
+    static constexpr std::size_t kMaxTiles = 4096;
+
+    int cellSize_;
+    int scale_;
+    int size_;
+    std::unordered_map<Key, std::size_t, KeyHash> offsets_;
+    std::vector<unsigned char> tiles_;
+};
+
+}
+
+#endif //GLYPH_BLIT_H
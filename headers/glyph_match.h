@@ -0,0 +1,47 @@
+//
+// Created by Dhruva Sharma on 18/2/25.
+//
+
+#ifndef GLYPH_MATCH_H
+#define GLYPH_MATCH_H
+
+#include <cstdint>
+
+// Shape matching of 8x8 tiles against font8x8 glyphs. Tiles and glyphs are both 64-bit masks with
+// bit 8 * row + col for the pixel in column col: the font8x8 row bytes (least significant bit
+// first on screen) read as one little-endian word. A tile's distance to a glyph is then the
+// popcount of their XOR.
+namespace glyph_match {
+
+constexpr uint64_t mask(const unsigned char* rows) {
+    uint64_t bits = 0;
+    for (int row = 0; row < 8; ++row) bits |= static_cast<uint64_t>(rows[row]) << (8 * row);
+    return bits;
+}
+
+// Set bits of a mask: a glyph's ink coverage, out of 64. Usable in constant expressions; the
+// matching loops below use the POPCNT instruction where there is one.
+constexpr int popcount(uint64_t bits) {
+    bits = bits - ((bits >> 1) & 0x5555555555555555ULL);
+    bits = (bits & 0x3333333333333333ULL) + ((bits >> 2) & 0x3333333333333333ULL);
+    bits = (bits + (bits >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    return static_cast<int>((bits * 0x0101010101010101ULL) >> 56);
+}
+
+// A binarized tile. For the weighted distance every mismatched pixel costs 1, plus 1 for each
+// of the confident and certain planes it is also in, i.e. the further its value was from the
+// threshold the more it costs to get it wrong.
+struct TileMask {
+    uint64_t bits;
+    uint64_t confident;
+    uint64_t certain;
+};
+
+// Index of the mask nearest to tile by Hamming distance, the first of equals
+int nearest(const uint64_t* masks, int count, uint64_t tile);
+// Same by the weighted distance
+int nearestWeighted(const uint64_t* masks, int count, const TileMask& tile);
+
+}
+
+#endif //GLYPH_MATCH_H
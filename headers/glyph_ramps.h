@@ -0,0 +1,122 @@
+//
+// Created by Dhruva Sharma on 18/2/25.
+//
+
+#ifndef GLYPH_RAMPS_H
+#define GLYPH_RAMPS_H
+
+#include "font8x8_glyphs.h"
+#include "glyph_match.h"
+#include <cstddef>
+#include <cstdint>
+
+// Brightness ramps for the ASCII character sets, built at compile time from the ink coverage of
+// each glyph's font8x8 bitmap rather than from the order the characters happen to be listed in
+namespace glyph_ramps {
+
+// Lit pixels of codepoint's glyph, out of 64; 0 for one the font does not have
+constexpr int coverage(char32_t codepoint) {
+    const unsigned char* rows = font8x8::glyph(codepoint);
+    return rows ? glyph_match::popcount(glyph_match::mask(rows)) : 0;
+}
+
+// Brightness quantized to 256 levels, straight to a glyph
+struct Ramp {
+    char32_t glyphs[256];
+};
+
+// Each level takes the glyph whose coverage is nearest to it, with levels 0 and 255 at the
+// sparsest and densest glyph of the set. Of glyphs with equal coverage the first listed wins.
+constexpr Ramp makeRamp(const char32_t* chars, int count) {
+    char32_t sorted[128] = {};
+    int ink[128] = {};
+    count = count < 128 ? count : 128;
+    for (int i = 0; i < count; ++i) {
+        // Insertion sort, stable so ties keep their listed order
+        int j = i;
+        int c = coverage(chars[i]);
+        for (; j > 0 && ink[j - 1] > c; --j) {
+            sorted[j] = sorted[j - 1];
+            ink[j] = ink[j - 1];
+        }
+        sorted[j] = chars[i];
+        ink[j] = c;
+    }
+    Ramp ramp = {};
+    int glyph = 0;
+    for (int level = 0; level < 256; ++level) {
+        // Coverage is sorted, so the nearest glyph only ever moves forwards, and only ever to the
+        // first glyph of the next coverage
+        double target = ink[0] + (ink[count - 1] - ink[0]) * (level / 255.0);
+        for (;;) {
+            int next = glyph + 1;
+            while (next < count && ink[next] == ink[glyph]) ++next;
+            if (next == count || !(ink[next] - target < target - ink[glyph])) break;
+            glyph = next;
+        }
+        ramp.glyphs[level] = sorted[glyph];
+    }
+    return ramp;
+}
+
+template <std::size_t N>
+constexpr Ramp makeRamp(const char32_t (&chars)[N]) {
+    return makeRamp(chars, static_cast<int>(N - 1));
+}
+
+inline constexpr Ramp basic = makeRamp(U" .:-=+*#%@");
+inline constexpr Ramp extended =
+    makeRamp(U" .'`^\",:;Il!i><~+_-?][}{1)(|\\/tfjrxnuvczXYUJCLQ0OZmwqpdbkhao*#MW&8%B@$");
+inline constexpr Ramp artistic = makeRamp(U" \u2591\u2592\u2593\u2588");  // " ░▒▓█"
+inline constexpr Ramp simple = makeRamp(U".#");
+inline constexpr Ramp retro = makeRamp(U" \u2588");  // " █"
+// Every printable font8x8_basic glyph, ' ' to '~'
+inline constexpr Ramp printable = [] {
+    char32_t chars[95] = {};
+    for (int i = 0; i < 95; ++i) chars[i] = static_cast<char32_t>(32 + i);
+    return makeRamp(chars, 95);
+}();
+
+// Glyphs a tile's shape can be matched to, with their masks in the same order. Glyphs whose mask
+// an earlier one already has are left out; the earlier one would win every tie anyway.
+constexpr int kMaxCandidates = 256;
+struct Candidates {
+    int count;
+    char32_t glyphs[kMaxCandidates];
+    uint64_t masks[kMaxCandidates];
+};
+
+// Every glyph the font has in the inclusive codepoint spans
+template <std::size_t N>
+constexpr Candidates makeCandidates(const char32_t (&spans)[N][2]) {
+    Candidates candidates = {};
+    for (std::size_t span = 0; span < N; ++span) {
+        for (char32_t codepoint = spans[span][0]; codepoint <= spans[span][1]; ++codepoint) {
+            const unsigned char* rows = font8x8::glyph(codepoint);
+            if (!rows || candidates.count == kMaxCandidates) continue;
+            uint64_t bits = glyph_match::mask(rows);
+            bool seen = false;
+            for (int i = 0; i < candidates.count && !seen; ++i) seen = candidates.masks[i] == bits;
+            if (seen) continue;
+            candidates.glyphs[candidates.count] = codepoint;
+            candidates.masks[candidates.count++] = bits;
+        }
+    }
+    return candidates;
+}
+
+inline constexpr char32_t printable_spans[1][2] = {{0x20, 0x7E}};
+inline constexpr char32_t block_spans[2][2] = {{0x20, 0x20}, {0x2500, 0x259F}};
+// ' ' to '~', for the text character sets
+inline constexpr Candidates printableShapes = makeCandidates(printable_spans);
+// Space, Box Drawing and Block Elements, for ARTISTIC and RETRO
+inline constexpr Candidates blockShapes = makeCandidates(block_spans);
+
+// brightness in [0, 1] to a ramp level
+constexpr int level(float brightness) {
+    return brightness <= 0.0f ? 0 : brightness >= 1.0f ? 255 : static_cast<int>(brightness * 255.0f + 0.5f);
+}
+
+}
+
+#endif //GLYPH_RAMPS_H
@@ -0,0 +1,61 @@
+//
+// Created by Dhruva Sharma on 18/2/25.
+//
+
+#ifndef GRAY_PIPELINE_H
+#define GRAY_PIPELINE_H
+
+#include <vector>
+#include "Image.h"
+#include "pallete.h"
+
+// Single-channel fast path used by every ditherer when the palette is achromatic:
+// decode to gray8, dither one channel, emit palette indices.
+//
+// For an achromatic palette the RGB distance to an entry only depends on the mean of the
+// three channels, so dithering the mean picks the same entries as the full RGB path.
+namespace gray_pipeline {
+    // Palettes with more entries than an index byte can hold stay on the RGB path
+    bool canUse(const Pallete& pallete);
+
+    // Mean of R, G and B per pixel, scaled to 0-255
+    std::vector<unsigned char> decodeGray8(const Image& image);
+
+    // Writes the palette color of every index into outputImage (resized to width x height)
+    void emitIndices(const std::vector<unsigned char>& indices, int width, int height,
+                     const Pallete& pallete, Image& outputImage);
+
+    // Gray levels of an achromatic palette, sorted, with an 8-bit lookup for the nearest entry
+    class GrayLevels {
+      public:
+        explicit GrayLevels(const Pallete& pallete);
+
+        // Palette index of the entry nearest to a gray value on the 0-255 scale (any range)
+        int closestIndex(float value) const;
+        // Gray value (0-255 scale) of a palette entry
+        float level(int index) const { return paletteLevels_[index]; }
+
+        // The sorted entries just below and above an integer gray value, and where the value sits
+        // in that gap (0-1). Ordered dithering takes `upper` when the fraction exceeds the threshold.
+        struct Step {
+            unsigned char lower;
+            unsigned char upper;
+            float fraction;
+        };
+        const Step& step(unsigned char value) const { return steps_[value]; }
+
+        // Distinct levels in ascending order, and the palette index of each
+        const std::vector<float>& sortedLevels() const { return sortedLevels_; }
+        int sortedIndex(int position) const { return sortedIndex_[position]; }
+
+      private:
+        std::vector<float> paletteLevels_;   // by palette index
+        std::vector<float> sortedLevels_;    // ascending, duplicates removed
+        std::vector<int> sortedIndex_;       // palette index of each sorted level
+        std::vector<float> midpoints_;       // between consecutive sorted levels
+        int nearest_[256];                   // sorted position nearest to each integer level
+        Step steps_[256];
+    };
+}
+
+#endif //GRAY_PIPELINE_H
@@ -0,0 +1,46 @@
+//
+// Created by Dhruva Sharma on 18/2/25.
+//
+
+#ifndef HALFTONE_DITHRER_H
+#define HALFTONE_DITHRER_H
+
+#include "dithrer.h"
+#include <array>
+#include <vector>
+
+enum class HalftoneMode {
+  CHANNELS,  // each RGB channel screened at its own angle, then matched to the palette
+  CMYK       // separated into C, M, Y, K inks, screened, and composited (the palette is not used)
+};
+
+// Clustered-dot AM halftoning, as used for print. Each screen is a lattice of round dots
+// `cellSize` pixels apart at a given angle. The angle is approximated by a rational tangent
+// (the integer step (a, b) nearest to cellSize * (cos, sin)), which makes the rotated screen
+// periodic with period (a^2 + b^2) / gcd(a, b) in x and y. One such tile of thresholds is
+// precomputed per screen, ranked so the tone response is linear, and the per-pixel work is a
+// lookup and a compare.
+class HalftoneDithrer : public Dither {
+  public:
+    // Screen angles in degrees, in ink order C, M, Y, K (classic 15, 75, 0, 45).
+    // In CHANNELS mode R, G and B use the C, M and Y angles; the gray path uses K.
+    HalftoneDithrer(float cellSize = 8.0f, HalftoneMode mode = HalftoneMode::CHANNELS,
+                    std::array<float, 4> angles = {15.0f, 75.0f, 0.0f, 45.0f});
+    ~HalftoneDithrer() override = default;
+
+    void applyDither(const Image& inputImage, Image& outputImage, const Pallete& pallete) override;
+
+    struct Screen {
+      int period;                          // tile width and height
+      std::vector<float> thresholds;       // period x period, values in (0, 1)
+      std::vector<unsigned char> levels;   // floor(threshold * 255)
+    };
+
+  private:
+    HalftoneMode mode_;
+    std::array<Screen, 4> screens_;
+
+    static Screen BuildScreen(float cellSize, float angle);
+};
+
+#endif //HALFTONE_DITHRER_H
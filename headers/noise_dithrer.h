@@ -0,0 +1,32 @@
+//
+// Created by Dhruva Sharma on 18/2/25.
+//
+
+#ifndef NOISE_DITHRER_H
+#define NOISE_DITHRER_H
+
+#include "dithrer.h"
+#include <cstdint>
+
+enum class NoiseType {
+  WHITE,       // uniform threshold in (0, 1) across each level gap
+  TRIANGULAR   // TPDF: additive noise of +-1 quantization step, then nearest level
+};
+
+// Random (noise) dithering. Each pixel's noise is Philox4x32-10 of the counter (x, y) under
+// the key `seed`, so output depends only on the seed and never on the order or split in
+// which rows are processed. Noise rows are generated eight pixels at a time with AVX2 when
+// the CPU has it, with an identical scalar fallback.
+class NoiseDithrer : public Dither {
+  public:
+    NoiseDithrer(NoiseType type = NoiseType::WHITE, uint64_t seed = 0);
+    ~NoiseDithrer() override = default;
+
+    void applyDither(const Image& inputImage, Image& outputImage, const Pallete& pallete) override;
+
+  private:
+    NoiseType type_;
+    uint64_t seed_;
+};
+
+#endif //NOISE_DITHRER_H
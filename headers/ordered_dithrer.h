@@ -6,7 +6,7 @@
 #define ORDERED_DITHRER_H
 
 #include "dithrer.h"
-#include <vector>
+#include "bayer_tables.h"
 
 
 class OrderedDithrer : public Dither {
@@ -17,9 +17,8 @@ class OrderedDithrer : public Dither {
     void applyDither(const Image& inputImage, Image& outputImage, const Pallete& pallete) override;
 
   private:
-    int bayerSize_;
-    std::vector<std::vector<float>> bayerMatrix_;
-    void GenerateBayerMatrix();
+    int bayerSize_;              // matrix order, 1 (2x2) to 8 (256x256)
+    bayer_tables::View bayer_;   // compile-time tables, shared by every instance
 
 };
 
@@ -0,0 +1,52 @@
+//
+// Created by Dhruva Sharma on 18/2/25.
+//
+
+#ifndef ORDERED_KERNELS_H
+#define ORDERED_KERNELS_H
+
+#include <vector>
+#include "gray_pipeline.h"
+
+// Packed 8-bit row kernels for ordered and threshold dithering on the gray8 path.
+// They apply when the palette's gray levels are evenly spaced from 0 to 255 (what
+// createGrayScalePallete builds); the position of a pixel inside its level gap is then plain
+// integer arithmetic. SSE4.2, AVX2 and AVX-512BW kernels handle 16, 32 and 64 pixels per
+// iteration and are bound through cpu_dispatch, with a scalar kernel that computes exactly the
+// same thing as the fallback.
+namespace ordered_kernels {
+
+// Tiled threshold rows are at least this many bytes, one chunk of the widest kernel
+constexpr int kRowAlign = 64;
+
+// A threshold matrix as bytes, floor(t * 255), each row repeated to a multiple of kRowAlign bytes
+// so a chunk never straddles the end of a row
+struct ThresholdTile {
+    int size = 0;   // rows (and columns) of the matrix, a power of two
+    int width = 0;  // bytes per tiled row
+    std::vector<unsigned char> levels;
+
+    const unsigned char* row(int y) const {
+        return levels.data() + static_cast<size_t>(y & (size - 1)) * width;
+    }
+};
+
+// thresholds: size x size, row-major, values in (0, 1)
+ThresholdTile tileThresholds(const float* thresholds, int size);
+
+// Evenly spaced gray levels and the palette index of each
+struct UniformRamp {
+    int steps = 0;                // levels - 1
+    unsigned char index[256] = {};
+};
+
+// False unless the palette's levels are 0, 255 / steps, ..., 255 (entry order may differ)
+bool uniformRamp(const gray_pipeline::GrayLevels& levels, UniformRamp& ramp);
+
+// Palette index per pixel of one row; thresholds is a tiled row of `tileWidth` bytes
+void ditherRow(const unsigned char* gray, const unsigned char* thresholds, int tileWidth,
+               unsigned char* out, int width, const UniformRamp& ramp);
+
+}
+
+#endif //ORDERED_KERNELS_H
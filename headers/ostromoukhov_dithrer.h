@@ -0,0 +1,22 @@
+//
+// Created by Dhruva Sharma on 18/2/25.
+//
+
+#ifndef OSTROMOUKHOV_DITHRER_H
+#define OSTROMOUKHOV_DITHRER_H
+
+#include "error_diffusion_dithrer.h"
+
+// Ostromoukhov's variable-coefficient error diffusion: the three Floyd-style weights change
+// with the input level, which avoids the worm artifacts of fixed kernels. The weights were tuned
+// for serpentine scanning, so that is the default; setSerpentine(false) trades it for speed.
+class OstromoukhovDithrer : public ErrorDiffusionDithrer {
+public:
+  OstromoukhovDithrer();
+  ~OstromoukhovDithrer() override = default;
+
+protected:
+  const float* KernelWeights(int level) const override;
+};
+
+#endif //OSTROMOUKHOV_DITHRER_H
@@ -6,6 +6,7 @@
 #define PALLETE_H
 #include <vector>
 #include "color.h"
+#include "pixel_kernels.h"
 
 class Pallete {
   public:
@@ -17,9 +18,14 @@ class Pallete {
     const Color& getColor(int index) const;
     int getSize() const;
     static Pallete createGrayScalePallete(int levels);
+    // True when every entry is achromatic (r == g == b), e.g. palettes from createGrayScalePallete
+    bool isGrayScale() const;
     const Color& GetClosestColor(const Color& color) const;
+    // GetClosestColor for `count` colors at once; `out` may be the same array as `colors`
+    void GetClosestColors(const Color* colors, Color* out, int count) const;
   private:
     std::vector<Color> colors_;
+    pixel_kernels::PaletteTable table_;
 };
 
 
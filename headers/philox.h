@@ -0,0 +1,45 @@
+//
+// Created by Dhruva Sharma on 18/2/25.
+//
+
+#ifndef PHILOX_H
+#define PHILOX_H
+
+#include <array>
+#include <cstdint>
+
+// Philox4x32-10 (Salmon et al., "Parallel random numbers: as easy as 1, 2, 3").
+// A counter-based generator: the output is a pure function of (counter, key), so any
+// pixel's random numbers can be drawn directly from its coordinates, in any order.
+namespace philox {
+
+constexpr uint32_t kMultiplier0 = 0xD2511F53u;
+constexpr uint32_t kMultiplier1 = 0xCD9E8D57u;
+constexpr uint32_t kWeyl0 = 0x9E3779B9u;
+constexpr uint32_t kWeyl1 = 0xBB67AE85u;
+constexpr int kRounds = 10;
+
+using Counter = std::array<uint32_t, 4>;
+using Key = std::array<uint32_t, 2>;
+
+constexpr Counter philox4x32(Counter counter, Key key) {
+    for (int round = 0; round < kRounds; ++round) {
+        if (round > 0) {
+            key[0] += kWeyl0;
+            key[1] += kWeyl1;
+        }
+        uint64_t product0 = static_cast<uint64_t>(kMultiplier0) * counter[0];
+        uint64_t product1 = static_cast<uint64_t>(kMultiplier1) * counter[2];
+        counter = {static_cast<uint32_t>(product1 >> 32) ^ counter[1] ^ key[0], static_cast<uint32_t>(product1),
+                   static_cast<uint32_t>(product0 >> 32) ^ counter[3] ^ key[1], static_cast<uint32_t>(product0)};
+    }
+    return counter;
+}
+
+// Known-answer test from the Random123 distribution
+static_assert(philox4x32({0, 0, 0, 0}, {0, 0})[0] == 0x6627e8d5u &&
+              philox4x32({0, 0, 0, 0}, {0, 0})[3] == 0x9b00dbd8u, "Philox4x32-10 known answer");
+
+}
+
+#endif //PHILOX_H
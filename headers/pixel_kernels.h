@@ -0,0 +1,51 @@
+//
+// Created by Dhruva Sharma on 18/2/25.
+//
+
+#ifndef PIXEL_KERNELS_H
+#define PIXEL_KERNELS_H
+
+#include <cstddef>
+#include <vector>
+#include "color.h"
+
+// Per-pixel kernels with SSE4.2, AVX2 and AVX-512 variants picked through cpu_dispatch.
+// Every variant does the same float operations in the same order as the scalar one, so the
+// results do not depend on the CPU.
+namespace pixel_kernels {
+
+// Mean of R, G and B clamped to [0, 1], scaled to 0-255 and rounded
+void colorsToGray8(const Color* in, unsigned char* out, int count);
+
+// RGBA bytes of each color: channels clamped to [0, 1], times 255, truncated
+void colorsToRgba8(const Color* in, unsigned char* out, int count);
+
+// Colors from RGBA bytes, every channel divided by 255
+void rgba8ToColors(const unsigned char* in, Color* out, int count);
+
+// Palette entries as R, G and B planes, padded with entries that never match
+class PaletteTable {
+  public:
+    PaletteTable() = default;
+    explicit PaletteTable(const std::vector<Color>& colors);
+
+    int size() const { return size_; }
+    int padded() const { return padded_; }
+    const float* plane(int channel) const { return planes_.data() + static_cast<size_t>(channel) * padded_; }
+
+  private:
+    int size_ = 0;
+    int padded_ = 0;
+    std::vector<float> planes_;
+};
+
+// Entry with the smallest squared RGB distance, the earlier one on ties;
+// -1 when nothing is closer than FLT_MAX (an empty table, or a NaN color)
+int nearestIndex(const PaletteTable& table, const Color& color);
+
+// nearestIndex for each of `count` colors
+void nearestIndices(const PaletteTable& table, const Color* colors, int count, int* out);
+
+}
+
+#endif //PIXEL_KERNELS_H
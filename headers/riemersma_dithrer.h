@@ -0,0 +1,33 @@
+//
+// Created by Dhruva Sharma on 18/2/25.
+//
+
+#ifndef RIEMERSMA_DITHRER_H
+#define RIEMERSMA_DITHRER_H
+
+#include "dithrer.h"
+#include <vector>
+
+// Riemersma dithering: error diffusion along a Hilbert curve, where each pixel receives a
+// weighted sum of the last few quantization errors (newest weight 1, oldest weight `ratio`).
+// The curve is walked block by block so the working set stays in cache; every block starts
+// with an empty history, which makes blocks independent units of work.
+class RiemersmaDithrer : public Dither {
+  public:
+    RiemersmaDithrer(int blockSize = 64, int historyLength = 16, float ratio = 1.0f / 16.0f);
+    ~RiemersmaDithrer() override = default;
+
+    void applyDither(const Image& inputImage, Image& outputImage, const Pallete& pallete) override;
+
+  private:
+    int blockSize_;
+    int historyLength_;
+    float decay_;         // weight ratio between consecutive history entries
+    float oldestWeight_;  // decay_ ^ historyLength_, removed when an error leaves the history
+    // Hilbert order of one block, as (x, y) offsets packed into x + y * blockSize_
+    std::vector<int> curve_;
+
+    void GenerateCurve();
+};
+
+#endif //RIEMERSMA_DITHRER_H
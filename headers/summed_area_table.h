@@ -0,0 +1,43 @@
+//
+// Created by Dhruva Sharma on 18/2/25.
+//
+
+#ifndef SUMMED_AREA_TABLE_H
+#define SUMMED_AREA_TABLE_H
+
+#include <vector>
+
+// Integral images of a float plane and of its square, so the sum, mean and variance over any
+// rectangle cost four lookups whatever its size or offset. Sums are kept in double: a float
+// prefix over a whole image would lose the low bits a single tile depends on.
+class SummedAreaTable {
+  public:
+    SummedAreaTable() = default;
+
+    // plane: width x height, row-major. Rows are prefixed in parallel, then columns.
+    void build(const float* plane, int width, int height);
+
+    int width() const { return width_; }
+    int height() const { return height_; }
+
+    // Over the pixels of [x0, x1) x [y0, y1) that lie inside the plane
+    int count(int x0, int y0, int x1, int y1) const;
+    double sum(int x0, int y0, int x1, int y1) const;
+    double sumOfSquares(int x0, int y0, int x1, int y1) const;
+    // 0 for a rectangle with no pixels inside the plane
+    float mean(int x0, int y0, int x1, int y1) const;
+    float variance(int x0, int y0, int x1, int y1) const;
+
+  private:
+    // Clips the rectangle to the plane; false if nothing is left
+    bool Clip(int& x0, int& y0, int& x1, int& y1) const;
+    double Lookup(const std::vector<double>& table, int x0, int y0, int x1, int y1) const;
+
+    int width_ = 0;
+    int height_ = 0;
+    // (width + 1) x (height + 1), with a zero first row and column
+    std::vector<double> sums_;
+    std::vector<double> squares_;
+};
+
+#endif //SUMMED_AREA_TABLE_H
@@ -0,0 +1,57 @@
+//
+// Created by Dhruva Sharma on 18/2/25.
+//
+
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <mutex>
+
+// Process-wide work-stealing scheduler shared by every ditherer and image stage.
+// Each worker owns a deque: it pops its own tasks newest first and steals the oldest tasks of
+// the others when it runs dry; tasks submitted from outside the pool go to a shared queue.
+// A thread waiting for tasks runs queued work instead of blocking, so tasks may start and
+// wait for tasks of their own.
+namespace thread_pool {
+
+// Threads taking part in parallel work, the calling thread included; 0 or less means one per
+// hardware thread. The workers are restarted, so change it between jobs, never from a task.
+void setThreadCount(int count);
+int threadCount();
+
+// A batch of tasks that can be awaited together
+class TaskGroup {
+  public:
+    TaskGroup() = default;
+    // Waits for any tasks still running; their exceptions are dropped
+    ~TaskGroup();
+    TaskGroup(const TaskGroup&) = delete;
+    TaskGroup& operator=(const TaskGroup&) = delete;
+
+    void run(std::function<void()> task);
+    // Returns once every task has finished, rethrowing the first exception a task threw
+    void wait();
+
+  private:
+    void Drain();
+
+    std::atomic<int> pending_{0};
+    std::mutex errorMutex_;
+    std::exception_ptr error_;
+};
+
+// Calls body(first, last) on consecutive chunks of [begin, end) of `grain` items (0 picks one
+// from the range and the thread count) and returns when all of them are done. The calling
+// thread takes a share of the chunks; with one thread the whole range is a single call.
+void parallelFor(int begin, int end, int grain, const std::function<void(int, int)>& body);
+
+// Same over a width x height area split into tiles; body(x0, y0, x1, y1) gets one tile
+void parallelForTiles(int width, int height, int tileWidth, int tileHeight,
+                      const std::function<void(int, int, int, int)>& body);
+
+}
+
+#endif //THREAD_POOL_H
@@ -2,6 +2,7 @@
 #define THRESHOLD_DITHRER_H
 
 #include "dithrer.h"
+#include "ordered_kernels.h"
 
 class ThresholdDithrer : public Dither {
 public:
@@ -10,6 +11,7 @@ public:
     void applyDither(const Image& inputImage, Image& outputImage, const Pallete& pallete) override;
 private:
     float threshold_;
+    ordered_kernels::ThresholdTile tile_;  // the single threshold, as one kRowAlign-byte row
 };
 
 #endif // THRESHOLD_DITHRER_H 
\ No newline at end of file
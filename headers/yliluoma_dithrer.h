@@ -0,0 +1,29 @@
+//
+// Created by Dhruva Sharma on 18/2/25.
+//
+
+#ifndef YLILUOMA_DITHRER_H
+#define YLILUOMA_DITHRER_H
+
+#include "dithrer.h"
+#include "bayer_tables.h"
+
+// Yliluoma's positional pattern dithering (his "algorithm 2") for arbitrary palettes.
+// Every input color gets a mixing plan: kPlanSize palette entries whose mean approximates it,
+// sorted by luma. The Bayer threshold of a pixel then picks one entry of its plan.
+// Plans are cached per palette and 15-bit quantized color in a table shared by all instances,
+// so after the first pass over an image's colors each pixel is two lookups.
+class YliluomaDithrer : public Dither {
+  public:
+    static constexpr int kPlanSize = 16;
+
+    YliluomaDithrer();
+    ~YliluomaDithrer() override = default;
+
+    void applyDither(const Image& inputImage, Image& outputImage, const Pallete& pallete) override;
+
+  private:
+    bayer_tables::View matrix_;  // 8x8
+};
+
+#endif //YLILUOMA_DITHRER_H
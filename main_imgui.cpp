@@ -11,7 +11,15 @@
 #include "headers/ordered_dithrer.h"
 #include "headers/threshold_dithrer.h"
 #include "headers/ascii_dithrer.h"
+#include "headers/dot_diffusion_dithrer.h"
+#include "headers/ostromoukhov_dithrer.h"
+#include "headers/riemersma_dithrer.h"
+#include "headers/blue_noise_dithrer.h"
+#include "headers/yliluoma_dithrer.h"
+#include "headers/halftone_dithrer.h"
+#include "headers/noise_dithrer.h"
 #include "headers/pallete.h"
+#include "headers/thread_pool.h"
 #include <memory>
 
 // GL loader: glad, glew, gl3w, etc. Not needed for macOS OpenGL 3.2+ core profile
@@ -74,8 +82,17 @@ GLuint UploadImageToTexture(const Image& img) {
     return tex;
 }
 
-int main(int, char**)
+int main(int argc, char** argv)
 {
+    // Worker threads for dithering; the settings panel can change it between runs
+    static int thread_count = 0;
+    for (int i = 1; i + 1 < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "-j" || arg == "--threads") thread_count = std::stoi(argv[++i]);
+    }
+    if (thread_count < 0) thread_count = 0;
+    thread_pool::setThreadCount(thread_count);
+
     // Setup GLFW
     if (!glfwInit())
         return 1;
@@ -112,15 +129,25 @@ int main(int, char**)
     static int palette_idx = 0;
     static int grayscale_levels = 4;
     static int bayer_size = 2;
+    static int noise_size_idx = 0;
+    static float cell_size = 8.0f;
+    static bool cmyk = false;
+    static bool tpdf = false;
+    static bool optimized_classes = false;
+    static int noise_seed = 0;
+    const int noise_sizes[] = {64, 128, 256};
+    const char* noise_size_names[] = {"64x64", "128x128", "256x256"};
     static float threshold = 0.5f;
     static int ascii_set_idx = 1;
     static bool detect_edges = true;
+    static bool serpentine = false;
+    static bool ostromoukhov_serpentine = true;
     // UI state
     static char status_message[256] = "Ready";
     static bool is_processing = false;
     static char save_path[512] = "output.png";
     // Algorithm/palette names
-    const char* algorithms[] = {"Floyd-Steinberg", "Atkinson", "Ordered (Bayer)", "Threshold", "ASCII"};
+    const char* algorithms[] = {"Floyd-Steinberg", "Atkinson", "Ordered (Bayer)", "Threshold", "ASCII", "Dot Diffusion", "Ostromoukhov", "Riemersma", "Blue Noise", "Yliluoma", "Halftone", "Noise"};
     const char* palettes[] = {"Grayscale", "GameBoy", "NES", "CGA"};
     const char* ascii_sets[] = {"Basic", "Extended", "Artistic", "Simple", "Shader", "Retro", "Advanced", "Font8x8"};
 
@@ -220,11 +247,36 @@ int main(int, char**)
             ImGui::SliderInt("Grayscale Levels", &grayscale_levels, 2, 16);
         }
         
+        if (algorithm_idx == 0 || algorithm_idx == 1) {
+            ImGui::Checkbox("Serpentine Scan", &serpentine);
+        }
+        if (algorithm_idx == 6) {
+            ImGui::Checkbox("Serpentine Scan", &ostromoukhov_serpentine);
+        }
+        
         if (algorithm_idx == 2) {
-            ImGui::SliderInt("Bayer Size", &bayer_size, 1, 4);
+            ImGui::SliderInt("Bayer Size", &bayer_size, 1, 8);
             ImGui::Text("Matrix: %dx%d", 1 << bayer_size, 1 << bayer_size);
         }
         
+        if (algorithm_idx == 5) {
+            ImGui::Checkbox("Optimized Class Matrix", &optimized_classes);
+        }
+        
+        if (algorithm_idx == 8) {
+            ImGui::Combo("Mask Size", &noise_size_idx, noise_size_names, IM_ARRAYSIZE(noise_size_names));
+        }
+        
+        if (algorithm_idx == 10) {
+            ImGui::SliderFloat("Cell Size", &cell_size, 2.0f, 24.0f, "%.1f px");
+            ImGui::Checkbox("CMYK Separation", &cmyk);
+        }
+        
+        if (algorithm_idx == 11) {
+            ImGui::Checkbox("Triangular (TPDF)", &tpdf);
+            ImGui::InputInt("Seed", &noise_seed);
+        }
+        
         if (algorithm_idx == 3) {
             ImGui::SliderFloat("Threshold", &threshold, 0.0f, 1.0f, "%.2f");
         }
@@ -234,6 +286,11 @@ int main(int, char**)
             ImGui::Checkbox("Detect Edges", &detect_edges);
         }
         
+        // 0 picks one thread per core; jobs run on this thread, so the pool is idle here
+        if (ImGui::SliderInt("Threads", &thread_count, 0, 64, thread_count == 0 ? "Auto" : "%d")) {
+            thread_pool::setThreadCount(thread_count);
+        }
+        
         ImGui::Spacing();
         
         // Dither button
@@ -254,11 +311,33 @@ int main(int, char**)
             // Ditherer selection
             std::unique_ptr<Dither> ditherer;
             switch (algorithm_idx) {
-                case 0: ditherer = std::make_unique<FloydDithrer>(); break;
-                case 1: ditherer = std::make_unique<AtkinsonDithrer>(); break;
+                case 0: {
+                    auto floyd = std::make_unique<FloydDithrer>();
+                    floyd->setSerpentine(serpentine);
+                    ditherer = std::move(floyd);
+                    break;
+                }
+                case 1: {
+                    auto atkinson = std::make_unique<AtkinsonDithrer>();
+                    atkinson->setSerpentine(serpentine);
+                    ditherer = std::move(atkinson);
+                    break;
+                }
                 case 2: ditherer = std::make_unique<OrderedDithrer>(bayer_size); break;
                 case 3: ditherer = std::make_unique<ThresholdDithrer>(threshold); break;
                 case 4: ditherer = std::make_unique<AsciiDithrer>((AsciiCharSet)ascii_set_idx, detect_edges); break;
+                case 5: ditherer = std::make_unique<DotDiffusionDithrer>(optimized_classes ? DotClassMatrix::OPTIMIZED : DotClassMatrix::KNUTH); break;
+                case 6: {
+                    auto ostromoukhov = std::make_unique<OstromoukhovDithrer>();
+                    ostromoukhov->setSerpentine(ostromoukhov_serpentine);
+                    ditherer = std::move(ostromoukhov);
+                    break;
+                }
+                case 7: ditherer = std::make_unique<RiemersmaDithrer>(); break;
+                case 8: ditherer = std::make_unique<BlueNoiseDithrer>(noise_sizes[noise_size_idx]); break;
+                case 9: ditherer = std::make_unique<YliluomaDithrer>(); break;
+                case 10: ditherer = std::make_unique<HalftoneDithrer>(cell_size, cmyk ? HalftoneMode::CMYK : HalftoneMode::CHANNELS); break;
+                case 11: ditherer = std::make_unique<NoiseDithrer>(tpdf ? NoiseType::TRIANGULAR : NoiseType::WHITE, static_cast<uint32_t>(noise_seed)); break;
                 default: ditherer = std::make_unique<FloydDithrer>(); break;
             }
             
@@ -0,0 +1,161 @@
+//
+// Created by Dhruva Sharma on 18/2/25.
+//
+
+#include "headers/noise_dithrer.h"
+#include "headers/channel_levels.h"
+#include "headers/cpu_dispatch.h"
+#include "headers/gray_pipeline.h"
+#include "headers/ordered_kernels.h"
+#include "headers/philox.h"
+#include "headers/thread_pool.h"
+#include <vector>
+
+namespace {
+
+// The top 16 bits of the first two Philox words for pixels begin..width-1 of row y.
+// Noise values are built from these: white t = (2a + 1) / 2^17, TPDF n = (a + b + 1) / 2^16 - 1.
+void NoiseRowScalar(philox::Key key, int y, int begin, int width, uint16_t* a, uint16_t* b) {
+  for (int x = begin; x < width; ++x) {
+    philox::Counter words = philox::philox4x32({static_cast<uint32_t>(x), static_cast<uint32_t>(y), 0, 0}, key);
+    a[x] = static_cast<uint16_t>(words[0] >> 16);
+    b[x] = static_cast<uint16_t>(words[1] >> 16);
+  }
+}
+
+#ifdef CPU_DISPATCH_X86
+// 32x32 -> 64 multiply of all eight lanes, split into high and low words
+__attribute__((target("avx2")))
+inline void MulHiLo(__m256i value, __m256i multiplier, __m256i& high, __m256i& low) {
+  __m256i even = _mm256_mul_epu32(value, multiplier);
+  __m256i odd = _mm256_mul_epu32(_mm256_srli_epi64(value, 32), multiplier);
+  low = _mm256_blend_epi32(even, _mm256_slli_epi64(odd, 32), 0xAA);
+  high = _mm256_blend_epi32(_mm256_srli_epi64(even, 32), odd, 0xAA);
+}
+
+__attribute__((target("avx2")))
+void NoiseRowAvx2(philox::Key key, int y, int width, uint16_t* a, uint16_t* b) {
+  const __m256i multiplier0 = _mm256_set1_epi32(static_cast<int>(philox::kMultiplier0));
+  const __m256i multiplier1 = _mm256_set1_epi32(static_cast<int>(philox::kMultiplier1));
+  const __m256i lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+  int x = 0;
+  for (; x + 8 <= width; x += 8) {
+    __m256i c0 = _mm256_add_epi32(_mm256_set1_epi32(x), lanes);
+    __m256i c1 = _mm256_set1_epi32(y);
+    __m256i c2 = _mm256_setzero_si256();
+    __m256i c3 = _mm256_setzero_si256();
+    uint32_t k0 = key[0], k1 = key[1];
+    for (int round = 0; round < philox::kRounds; ++round) {
+      if (round > 0) {
+        k0 += philox::kWeyl0;
+        k1 += philox::kWeyl1;
+      }
+      __m256i high0, low0, high1, low1;
+      MulHiLo(c0, multiplier0, high0, low0);
+      MulHiLo(c2, multiplier1, high1, low1);
+      c0 = _mm256_xor_si256(_mm256_xor_si256(high1, c1), _mm256_set1_epi32(static_cast<int>(k0)));
+      c1 = low1;
+      c2 = _mm256_xor_si256(_mm256_xor_si256(high0, c3), _mm256_set1_epi32(static_cast<int>(k1)));
+      c3 = low0;
+    }
+    // Top halves of c0 and c1, packed to eight 16-bit values each
+    __m256i top0 = _mm256_srli_epi32(c0, 16);
+    __m256i top1 = _mm256_srli_epi32(c1, 16);
+    __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi32(top0, top1), 0xD8);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(a + x), _mm256_castsi256_si128(packed));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(b + x), _mm256_extracti128_si256(packed, 1));
+  }
+  NoiseRowScalar(key, y, x, width, a, b);
+}
+#endif
+
+using NoiseRowKernel = void (*)(philox::Key, int, int, uint16_t*, uint16_t*);
+
+void NoiseRowFallback(philox::Key key, int y, int width, uint16_t* a, uint16_t* b) {
+  NoiseRowScalar(key, y, 0, width, a, b);
+}
+
+NoiseRowKernel SelectKernel() {
+#ifdef CPU_DISPATCH_X86
+  // The AVX2 kernel also serves AVX-512 machines; Philox rounds gain little from wider lanes
+  if (cpu_dispatch::activeIsa() >= cpu_dispatch::Isa::AVX2) return NoiseRowAvx2;
+#endif
+  return NoiseRowFallback;
+}
+
+void NoiseRow(philox::Key key, int y, int width, uint16_t* a, uint16_t* b) {
+  static const NoiseRowKernel kernel = SelectKernel();
+  kernel(key, y, width, a, b);
+}
+
+inline float WhiteThreshold(uint16_t a) { return (2.0f * a + 1.0f) / 131072.0f; }
+inline float TriangularOffset(uint16_t a, uint16_t b) { return (static_cast<float>(a) + b + 1.0f) / 65536.0f - 1.0f; }
+
+}
+
+NoiseDithrer::NoiseDithrer(NoiseType type, uint64_t seed) : type_(type), seed_(seed) {}
+
+void NoiseDithrer::applyDither(const Image& inputImage, Image& outputImage, const Pallete& pallete) {
+  int width = inputImage.getWidth();
+  int height = inputImage.getHeight();
+  philox::Key key = {static_cast<uint32_t>(seed_), static_cast<uint32_t>(seed_ >> 32)};
+
+  if (gray_pipeline::canUse(pallete)) {
+    std::vector<unsigned char> gray = gray_pipeline::decodeGray8(inputImage);
+    gray_pipeline::GrayLevels levels(pallete);
+    std::vector<unsigned char> indices(gray.size());
+    ordered_kernels::UniformRamp ramp;
+    bool uniform = type_ == NoiseType::WHITE && ordered_kernels::uniformRamp(levels, ramp);
+    int rowWidth = ordered_kernels::kRowAlign;
+    while (rowWidth < width) rowWidth *= 2;
+    // Gap between the levels around each gray value, for the TPDF offset
+    float gap[256];
+    for (int v = 0; v < 256; ++v) {
+      const gray_pipeline::GrayLevels::Step& step = levels.step(static_cast<unsigned char>(v));
+      gap[v] = levels.level(step.upper) - levels.level(step.lower);
+    }
+
+    // Every row is a function of its counter, so bands of rows only need their own scratch
+    thread_pool::parallelFor(0, height, 0, [&](int first, int last) {
+      std::vector<uint16_t> a(width), b(width);
+      std::vector<unsigned char> thresholds(uniform ? rowWidth : 0);
+      for (int y = first; y < last; ++y) {
+        NoiseRow(key, y, width, a.data(), b.data());
+        const unsigned char* in = gray.data() + static_cast<size_t>(y) * width;
+        unsigned char* out = indices.data() + static_cast<size_t>(y) * width;
+        if (uniform) {
+          // floor(t * 255) for t = (2a + 1) / 2^17
+          for (int x = 0; x < width; ++x) thresholds[x] = static_cast<unsigned char>(((2 * a[x] + 1) * 255) >> 17);
+          ordered_kernels::ditherRow(in, thresholds.data(), rowWidth, out, width, ramp);
+        } else if (type_ == NoiseType::WHITE) {
+          for (int x = 0; x < width; ++x) {
+            const gray_pipeline::GrayLevels::Step& step = levels.step(in[x]);
+            out[x] = step.fraction > WhiteThreshold(a[x]) ? step.upper : step.lower;
+          }
+        } else {
+          for (int x = 0; x < width; ++x) {
+            out[x] = static_cast<unsigned char>(levels.closestIndex(in[x] + TriangularOffset(a[x], b[x]) * gap[in[x]]));
+          }
+        }
+      }
+    });
+    gray_pipeline::emitIndices(indices, width, height, pallete, outputImage);
+    return;
+  }
+
+  outputImage = inputImage;
+  ChannelLevels levels(pallete);
+  thread_pool::parallelFor(0, height, 0, [&](int first, int last) {
+    std::vector<uint16_t> a(width), b(width);
+    for (int y = first; y < last; ++y) {
+      NoiseRow(key, y, width, a.data(), b.data());
+      const Color* in = inputImage.getRow(y);
+      Color* out = outputImage.getRow(y);
+      for (int x = 0; x < width; ++x) {
+        out[x] = type_ == NoiseType::WHITE ? levels.spread(in[x], WhiteThreshold(a[x]))
+                                           : levels.offset(in[x], TriangularOffset(a[x], b[x]));
+      }
+      pallete.GetClosestColors(out, out, width);
+    }
+  });
+}
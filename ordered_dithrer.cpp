@@ -2,60 +2,64 @@
 // Created by Dhruva Sharma on 18/2/25.
 //
 #include "headers/ordered_dithrer.h"
+#include "headers/gray_pipeline.h"
+#include "headers/channel_levels.h"
+#include "headers/ordered_kernels.h"
+#include "headers/thread_pool.h"
 #include <vector>
-#include <cmath>
-#include <functional>
 
-OrderedDithrer::OrderedDithrer(int bayerSize) : bayerSize_(bayerSize) {
-  GenerateBayerMatrix();
-}
-
-void OrderedDithrer::GenerateBayerMatrix() {
-  bayerMatrix_.clear();
-  if (bayerSize_ < 0) return; // invalid size
+OrderedDithrer::OrderedDithrer(int bayerSize)
+    : bayerSize_(bayerSize < bayer_tables::kMinOrder ? bayer_tables::kMinOrder
+                 : bayerSize > bayer_tables::kMaxOrder ? bayer_tables::kMaxOrder : bayerSize),
+      bayer_(bayer_tables::view(bayerSize_)) {}
 
-  int size = 1 << bayerSize_;
-  bayerMatrix_.resize(size, std::vector<float>(size, 0.0f));
+void OrderedDithrer::applyDither(const Image& inputImage, Image& outputImage, const Pallete& pallete) {
+  int width = inputImage.getWidth();
+  int height = inputImage.getHeight();
+  int mask = bayer_.size - 1;
 
-  // Helper lambda for recursive Bayer matrix generation
-  std::function<void(int, int, int, int, int)> fillBayer = [&](int x, int y, int s, int value, int step) {
-    if (s == 1) {
-      bayerMatrix_[y][x] = static_cast<float>(value);
+  if (gray_pipeline::canUse(pallete)) {
+    std::vector<unsigned char> gray = gray_pipeline::decodeGray8(inputImage);
+    gray_pipeline::GrayLevels levels(pallete);
+    std::vector<unsigned char> indices(gray.size());
+    ordered_kernels::UniformRamp ramp;
+    if (ordered_kernels::uniformRamp(levels, ramp)) {
+      thread_pool::parallelFor(0, height, 0, [&](int first, int last) {
+        for (int y = first; y < last; ++y) {
+          size_t offset = static_cast<size_t>(y) * width;
+          const unsigned char* thresholds = bayer_.levels + static_cast<size_t>(y & mask) * bayer_.width8;
+          ordered_kernels::ditherRow(gray.data() + offset, thresholds, bayer_.width8, indices.data() + offset, width, ramp);
+        }
+      });
+      gray_pipeline::emitIndices(indices, width, height, pallete, outputImage);
       return;
     }
-    int hs = s / 2;
-    fillBayer(x,     y,     hs, value,           step * 4);
-    fillBayer(x+hs,  y,     hs, value + step,    step * 4);
-    fillBayer(x,     y+hs,  hs, value + step*2,  step * 4);
-    fillBayer(x+hs,  y+hs,  hs, value + step*3,  step * 4);
-  };
-  fillBayer(0, 0, size, 0, 1);
-
-  // Normalize to [0, 1]
-  float norm = static_cast<float>(size * size);
-  for (int y = 0; y < size; ++y) {
-    for (int x = 0; x < size; ++x) {
-      bayerMatrix_[y][x] = (bayerMatrix_[y][x] + 0.5f) / norm;
-    }
+    thread_pool::parallelFor(0, height, 0, [&](int first, int last) {
+      for (int y = first; y < last; ++y) {
+        const unsigned char* in = gray.data() + static_cast<size_t>(y) * width;
+        unsigned char* out = indices.data() + static_cast<size_t>(y) * width;
+        const float* thresholds = bayer_.thresholds + (y & mask) * bayer_.size;
+        for (int x = 0; x < width; ++x) {
+          const gray_pipeline::GrayLevels::Step& step = levels.step(in[x]);
+          out[x] = step.fraction > thresholds[x & mask] ? step.upper : step.lower;
+        }
+      }
+    });
+    gray_pipeline::emitIndices(indices, width, height, pallete, outputImage);
+    return;
   }
-}
 
-void OrderedDithrer::applyDither(const Image& inputImage, Image& outputImage, const Pallete& pallete) {
-  int width = inputImage.getWidth();
-  int height = inputImage.getHeight();
   outputImage = inputImage;
-  int size = 1 << bayerSize_;
-
-  for (int y = 0; y < height; ++y) {
-    for (int x = 0; x < width; ++x) {
-      Color orig = inputImage.getPixel(x, y);
-      // Use luminance for thresholding (simple average)
-      float lum = (orig.r + orig.g + orig.b) / 3.0f;
-      float threshold = bayerMatrix_[y % size][x % size];
-      float newLum = lum > threshold ? 1.0f : 0.0f;
-      Color newColor = pallete.GetClosestColor(Color(newLum, newLum, newLum));
-      outputImage.setPixel(x, y, newColor);
+  ChannelLevels levels(pallete);
+  thread_pool::parallelFor(0, height, 0, [&](int first, int last) {
+    for (int y = first; y < last; ++y) {
+      const Color* in = inputImage.getRow(y);
+      Color* out = outputImage.getRow(y);
+      const float* thresholds = bayer_.thresholds + (y & mask) * bayer_.size;
+      for (int x = 0; x < width; ++x) {
+        out[x] = levels.spread(in[x], thresholds[x & mask]);
+      }
+      pallete.GetClosestColors(out, out, width);
     }
-  }
+  });
 }
-
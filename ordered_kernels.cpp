@@ -0,0 +1,202 @@
+//
+// Created by Dhruva Sharma on 18/2/25.
+//
+
+#include "headers/ordered_kernels.h"
+#include "headers/cpu_dispatch.h"
+#include <algorithm>
+#include <cmath>
+
+namespace ordered_kernels {
+
+namespace {
+
+// With s = gray * steps, the lower level is s / 255 and the position in the gap is
+// s % 255 on a 0-255 scale, which beats floor(t * 255) exactly when the fraction beats t.
+void DitherRowScalar(const unsigned char* gray, const unsigned char* thresholds, int tileWidth,
+                     unsigned char* out, int begin, int width, const UniformRamp& ramp) {
+    for (int x = begin; x < width; ++x) {
+        int s = gray[x] * ramp.steps;
+        int lower = s / 255;
+        int remainder = s - lower * 255;
+        out[x] = ramp.index[lower + (remainder > thresholds[x & (tileWidth - 1)] ? 1 : 0)];
+    }
+}
+
+#ifdef CPU_DISPATCH_X86
+__attribute__((target("sse4.2")))
+__m128i LevelsSse(__m128i gray16, __m128i threshold16, __m128i steps) {
+    const __m128i reciprocal = _mm_set1_epi16(static_cast<short>(0x8081));
+    const __m128i full = _mm_set1_epi16(255);
+    __m128i s = _mm_mullo_epi16(gray16, steps);
+    __m128i lower = _mm_srli_epi16(_mm_mulhi_epu16(s, reciprocal), 7);
+    __m128i remainder = _mm_sub_epi16(s, _mm_mullo_epi16(lower, full));
+    return _mm_sub_epi16(lower, _mm_cmpgt_epi16(remainder, threshold16));
+}
+
+__attribute__((target("sse4.2")))
+void DitherRowSse(const unsigned char* gray, const unsigned char* thresholds, int tileWidth,
+                  unsigned char* out, int width, const UniformRamp& ramp) {
+    const __m128i steps = _mm_set1_epi16(static_cast<short>(ramp.steps));
+    bool shuffle = ramp.steps < 16;
+    const __m128i table = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ramp.index));
+
+    int x = 0;
+    for (; x + 16 <= width; x += 16) {
+        __m128i g = _mm_loadu_si128(reinterpret_cast<const __m128i*>(gray + x));
+        __m128i t = _mm_loadu_si128(reinterpret_cast<const __m128i*>(thresholds + (x & (tileWidth - 1))));
+        __m128i low = LevelsSse(_mm_cvtepu8_epi16(g), _mm_cvtepu8_epi16(t), steps);
+        __m128i high = LevelsSse(_mm_cvtepu8_epi16(_mm_srli_si128(g, 8)), _mm_cvtepu8_epi16(_mm_srli_si128(t, 8)), steps);
+        __m128i levels = _mm_packus_epi16(low, high);
+        if (shuffle) {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + x), _mm_shuffle_epi8(table, levels));
+        } else {
+            alignas(16) unsigned char level[16];
+            _mm_store_si128(reinterpret_cast<__m128i*>(level), levels);
+            for (int i = 0; i < 16; ++i) out[x + i] = ramp.index[level[i]];
+        }
+    }
+    DitherRowScalar(gray, thresholds, tileWidth, out, x, width, ramp);
+}
+
+__attribute__((target("avx2")))
+__m256i LevelsAvx2(__m256i gray16, __m256i threshold16, __m256i steps) {
+    const __m256i reciprocal = _mm256_set1_epi16(static_cast<short>(0x8081));
+    const __m256i full = _mm256_set1_epi16(255);
+    __m256i s = _mm256_mullo_epi16(gray16, steps);                       // <= 255 * 255
+    __m256i lower = _mm256_srli_epi16(_mm256_mulhi_epu16(s, reciprocal), 7);  // s / 255
+    __m256i remainder = _mm256_sub_epi16(s, _mm256_mullo_epi16(lower, full));
+    // Both sides are below 256, so the signed compare is safe; true lanes are -1
+    return _mm256_sub_epi16(lower, _mm256_cmpgt_epi16(remainder, threshold16));
+}
+
+__attribute__((target("avx2")))
+void DitherRowAvx2(const unsigned char* gray, const unsigned char* thresholds, int tileWidth,
+                   unsigned char* out, int width, const UniformRamp& ramp) {
+    const __m256i steps = _mm256_set1_epi16(static_cast<short>(ramp.steps));
+    // Up to 16 levels the index remap is a single in-register byte shuffle
+    bool shuffle = ramp.steps < 16;
+    const __m256i table = _mm256_broadcastsi128_si256(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(ramp.index)));
+
+    int x = 0;
+    for (; x + 32 <= width; x += 32) {
+        __m256i g = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(gray + x));
+        __m256i t = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(thresholds + (x & (tileWidth - 1))));
+        __m256i low = LevelsAvx2(_mm256_cvtepu8_epi16(_mm256_castsi256_si128(g)),
+                                 _mm256_cvtepu8_epi16(_mm256_castsi256_si128(t)), steps);
+        __m256i high = LevelsAvx2(_mm256_cvtepu8_epi16(_mm256_extracti128_si256(g, 1)),
+                                  _mm256_cvtepu8_epi16(_mm256_extracti128_si256(t, 1)), steps);
+        // packus interleaves the 128-bit lanes; restore pixel order
+        __m256i levels = _mm256_permute4x64_epi64(_mm256_packus_epi16(low, high), 0xD8);
+        if (shuffle) {
+            levels = _mm256_shuffle_epi8(table, levels);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + x), levels);
+        } else {
+            alignas(32) unsigned char level[32];
+            _mm256_store_si256(reinterpret_cast<__m256i*>(level), levels);
+            for (int i = 0; i < 32; ++i) out[x + i] = ramp.index[level[i]];
+        }
+    }
+    DitherRowScalar(gray, thresholds, tileWidth, out, x, width, ramp);
+}
+
+__attribute__((target("avx512f,avx512bw")))
+__m512i LevelsAvx512(__m512i gray16, __m512i threshold16, __m512i steps) {
+    const __m512i reciprocal = _mm512_set1_epi16(static_cast<short>(0x8081));
+    const __m512i full = _mm512_set1_epi16(255);
+    __m512i s = _mm512_mullo_epi16(gray16, steps);
+    __m512i lower = _mm512_srli_epi16(_mm512_mulhi_epu16(s, reciprocal), 7);
+    __m512i remainder = _mm512_sub_epi16(s, _mm512_mullo_epi16(lower, full));
+    __mmask32 above = _mm512_cmpgt_epi16_mask(remainder, threshold16);
+    return _mm512_mask_add_epi16(lower, above, lower, _mm512_set1_epi16(1));
+}
+
+__attribute__((target("avx512f,avx512bw")))
+void DitherRowAvx512(const unsigned char* gray, const unsigned char* thresholds, int tileWidth,
+                     unsigned char* out, int width, const UniformRamp& ramp) {
+    const __m512i steps = _mm512_set1_epi16(static_cast<short>(ramp.steps));
+    bool shuffle = ramp.steps < 16;
+    // The byte shuffle works per 128-bit lane, so every lane gets its own copy of the table
+    const __m512i table = _mm512_broadcast_i32x4(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ramp.index)));
+
+    int x = 0;
+    for (; x + 64 <= width; x += 64) {
+        __m512i g = _mm512_loadu_si512(gray + x);
+        __m512i t = _mm512_loadu_si512(thresholds + (x & (tileWidth - 1)));
+        __m512i low = LevelsAvx512(_mm512_cvtepu8_epi16(_mm512_castsi512_si256(g)),
+                                   _mm512_cvtepu8_epi16(_mm512_castsi512_si256(t)), steps);
+        __m512i high = LevelsAvx512(_mm512_cvtepu8_epi16(_mm512_extracti64x4_epi64(g, 1)),
+                                    _mm512_cvtepu8_epi16(_mm512_extracti64x4_epi64(t, 1)), steps);
+        // Levels are below 256, so narrowing keeps pixel order without a saturating pack
+        __m512i levels = _mm512_inserti64x4(_mm512_castsi256_si512(_mm512_cvtepi16_epi8(low)),
+                                            _mm512_cvtepi16_epi8(high), 1);
+        if (shuffle) {
+            _mm512_storeu_si512(out + x, _mm512_shuffle_epi8(table, levels));
+        } else {
+            alignas(64) unsigned char level[64];
+            _mm512_store_si512(level, levels);
+            for (int i = 0; i < 64; ++i) out[x + i] = ramp.index[level[i]];
+        }
+    }
+    DitherRowScalar(gray, thresholds, tileWidth, out, x, width, ramp);
+}
+#endif
+
+using RowKernel = void (*)(const unsigned char*, const unsigned char*, int, unsigned char*, int,
+                           const UniformRamp&);
+
+void DitherRowFallback(const unsigned char* gray, const unsigned char* thresholds, int tileWidth,
+                       unsigned char* out, int width, const UniformRamp& ramp) {
+    DitherRowScalar(gray, thresholds, tileWidth, out, 0, width, ramp);
+}
+
+RowKernel SelectKernel() {
+#ifdef CPU_DISPATCH_X86
+    switch (cpu_dispatch::activeIsa()) {
+        case cpu_dispatch::Isa::AVX512: return DitherRowAvx512;
+        case cpu_dispatch::Isa::AVX2: return DitherRowAvx2;
+        case cpu_dispatch::Isa::SSE42: return DitherRowSse;
+        default: break;
+    }
+#endif
+    return DitherRowFallback;
+}
+
+}
+
+ThresholdTile tileThresholds(const float* thresholds, int size) {
+    ThresholdTile tile;
+    tile.size = size;
+    tile.width = std::max(size, kRowAlign);
+    tile.levels.resize(static_cast<size_t>(size) * tile.width);
+    for (int y = 0; y < size; ++y) {
+        unsigned char* row = tile.levels.data() + static_cast<size_t>(y) * tile.width;
+        for (int x = 0; x < tile.width; ++x) {
+            float t = thresholds[y * size + (x & (size - 1))];
+            row[x] = static_cast<unsigned char>(std::floor(std::max(0.0f, std::min(1.0f, t)) * 255.0f));
+        }
+    }
+    return tile;
+}
+
+bool uniformRamp(const gray_pipeline::GrayLevels& levels, UniformRamp& ramp) {
+    const std::vector<float>& sorted = levels.sortedLevels();
+    int count = static_cast<int>(sorted.size());
+    if (count < 2 || count > 256) return false;
+    ramp.steps = count - 1;
+    for (int k = 0; k < count; ++k) {
+        float expected = 255.0f * k / ramp.steps;
+        if (std::fabs(sorted[k] - expected) > 1e-2f) return false;
+        ramp.index[k] = static_cast<unsigned char>(levels.sortedIndex(k));
+    }
+    return true;
+}
+
+void ditherRow(const unsigned char* gray, const unsigned char* thresholds, int tileWidth,
+               unsigned char* out, int width, const UniformRamp& ramp) {
+    static const RowKernel kernel = SelectKernel();
+    kernel(gray, thresholds, tileWidth, out, width, ramp);
+}
+
+}
@@ -0,0 +1,79 @@
+//
+// Created by Dhruva Sharma on 18/2/25.
+//
+
+#include "headers/ostromoukhov_dithrer.h"
+#include <array>
+
+// Coefficients for levels 0-127 from V. Ostromoukhov, "A Simple and Efficient Error-Diffusion
+// Algorithm" (SIGGRAPH 2001): right, down-left, down and their sum. Levels 128-255 mirror them.
+static constexpr int coefficients[128][4] = {
+    {   13,     0,     5,    18}, {   13,     0,     5,    18}, {   21,     0,    10,    31}, {    7,     0,     4,    11},
+    {    8,     0,     5,    13}, {   47,     3,    28,    78}, {   23,     3,    13,    39}, {   15,     3,     8,    26},
+    {   22,     6,    11,    39}, {   43,    15,    20,    78}, {    7,     3,     3,    13}, {  501,   224,   211,   936},
+    {  249,   116,   103,   468}, {  165,    80,    67,   312}, {  123,    62,    49,   234}, {  489,   256,   191,   936},
+    {   81,    44,    31,   156}, {  483,   272,   181,   936}, {   60,    35,    22,   117}, {   53,    32,    19,   104},
+    {  237,   148,    83,   468}, {  471,   304,   161,   936}, {    3,     2,     1,     6}, {  481,   314,   185,   980},
+    {  354,   226,   155,   735}, { 1389,   866,   685,  2940}, {  227,   138,   125,   490}, {  267,   158,   163,   588},
+    {  327,   188,   220,   735}, {   61,    34,    45,   140}, {  627,   338,   505,  1470}, { 1227,   638,  1075,  2940},
+    {   20,    10,    19,    49}, { 1937,  1000,  1767,  4704}, {  977,   520,   855,  2352}, {  657,   360,   551,  1568},
+    {   71,    40,    57,   168}, { 2005,  1160,  1539,  4704}, {  337,   200,   247,   784}, { 2039,  1240,  1425,  4704},
+    {  257,   160,   171,   588}, {  691,   440,   437,  1568}, { 1045,   680,   627,  2352}, {  301,   200,   171,   672},
+    {  177,   120,    95,   392}, { 2141,  1480,  1083,  4704}, { 1079,   760,   513,  2352}, {  725,   520,   323,  1568},
+    {  137,   100,    57,   294}, { 2209,  1640,   855,  4704}, {   53,    40,    19,   112}, { 2243,  1720,   741,  4704},
+    {  565,   440,   171,  1176}, {  759,   600,   209,  1568}, { 1147,   920,   285,  2352}, { 2311,  1880,   513,  4704},
+    {   97,    80,    19,   196}, {  335,   280,    57,   672}, { 1181,  1000,   171,  2352}, {  793,   680,    95,  1568},
+    {  599,   520,    57,  1176}, { 2413,  2120,   171,  4704}, {  405,   360,    19,   784}, { 2447,  2200,    57,  4704},
+    {   11,    10,     0,    21}, {  158,   151,     3,   312}, {  178,   179,     7,   364}, { 1030,  1091,    63,  2184},
+    {  248,   277,    21,   546}, {  318,   375,    35,   728}, {  458,   571,    63,  1092}, {  878,  1159,   147,  2184},
+    {    5,     7,     1,    13}, {  172,   181,    37,   390}, {   97,    76,    22,   195}, {   72,    41,    17,   130},
+    {  119,    47,    29,   195}, {    4,     1,     1,     6}, {    4,     1,     1,     6}, {    4,     1,     1,     6},
+    {    4,     1,     1,     6}, {    4,     1,     1,     6}, {    4,     1,     1,     6}, {    4,     1,     1,     6},
+    {    4,     1,     1,     6}, {    4,     1,     1,     6}, {   65,    18,    17,   100}, {   95,    29,    26,   150},
+    {  185,    62,    53,   300}, {   30,    11,     9,    50}, {   35,    14,    11,    60}, {   85,    37,    28,   150},
+    {   55,    26,    19,   100}, {   80,    41,    29,   150}, {  155,    86,    59,   300}, {    5,     3,     2,    10},
+    {    5,     3,     2,    10}, {    5,     3,     2,    10}, {    5,     3,     2,    10}, {    5,     3,     2,    10},
+    {    5,     3,     2,    10}, {    5,     3,     2,    10}, {  305,   176,   119,   600}, {  155,    86,    59,   300},
+    {  105,    56,    39,   200}, {   80,    41,    29,   150}, {   65,    32,    23,   120}, {   55,    26,    19,   100},
+    {  335,   152,   113,   600}, {   85,    37,    28,   150}, {  115,    48,    37,   200}, {   35,    14,    11,    60},
+    {  355,   136,   109,   600}, {   30,    11,     9,    50}, {  365,   128,   107,   600}, {  185,    62,    53,   300},
+    {   25,     8,     7,    40}, {   95,    29,    26,   150}, {  385,   112,   103,   600}, {   65,    18,    17,   100},
+    {  395,   104,   101,   600}, {    4,     1,     1,     6}, {    4,     1,     1,     6}, {    4,     1,     1,     6},
+    {    4,     1,     1,     6}, {    4,     1,     1,     6}, {    4,     1,     1,     6}, {    4,     1,     1,     6}
+};
+
+static constexpr bool CoefficientsSumToDivisor() {
+    for (const auto& row : coefficients) {
+        if (row[0] + row[1] + row[2] != row[3]) return false;
+    }
+    return true;
+}
+static_assert(CoefficientsSumToDivisor(), "Ostromoukhov coefficient rows must sum to their divisor");
+
+// Normalized weights for all 256 levels, built at compile time
+static constexpr std::array<std::array<float, 3>, 256> BuildLevelWeights() {
+    std::array<std::array<float, 3>, 256> weights{};
+    for (int level = 0; level < 256; ++level) {
+        const int* row = coefficients[level < 128 ? level : 255 - level];
+        for (int i = 0; i < 3; ++i) {
+            weights[level][i] = static_cast<float>(row[i]) / static_cast<float>(row[3]);
+        }
+    }
+    return weights;
+}
+static constexpr std::array<std::array<float, 3>, 256> levelWeights = BuildLevelWeights();
+
+//     X   r
+//  dl  d
+OstromoukhovDithrer::OstromoukhovDithrer() : ErrorDiffusionDithrer({
+    {1, 0, levelWeights[0][0]},
+    {-1, 1, levelWeights[0][1]},
+    {0, 1, levelWeights[0][2]}
+}) {
+    levelDependent_ = true;
+    setSerpentine(true);
+}
+
+const float* OstromoukhovDithrer::KernelWeights(int level) const {
+    return levelWeights[level].data();
+}
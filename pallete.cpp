@@ -7,11 +7,12 @@
 #include <algorithm>
 
 Pallete::Pallete() {}
-Pallete::Pallete(const std::vector<Color>& colors) : colors_(colors) {}
+Pallete::Pallete(const std::vector<Color>& colors) : colors_(colors), table_(colors_) {}
 Pallete::~Pallete() {}
 
 void Pallete::AddColor(const Color& color){
   colors_.push_back(color);
+  table_ = pixel_kernels::PaletteTable(colors_);
 }
 
 const Color& Pallete::getColor(int index) const {
@@ -32,21 +33,33 @@ const Color& Pallete::GetClosestColor(const Color& color) const {
     static const Color black = Color(0.0f, 0.0f, 0.0f);
     return black;
   }
-  float minDistanceSq = std::numeric_limits<float>::max();
-  const Color* closestColor = nullptr;
+  int index = pixel_kernels::nearestIndex(table_, color);
+  return colors_[index < 0 ? 0 : index];
+}
+
+void Pallete::GetClosestColors(const Color* colors, Color* out, int count) const {
+  if (colors_.empty()) {
+    std::fill(out, out + count, Color(0.0f, 0.0f, 0.0f));
+    return;
+  }
+  constexpr int kChunk = 256;
+  int indices[kChunk];
+  for (int first = 0; first < count; first += kChunk) {
+    int n = std::min(kChunk, count - first);
+    pixel_kernels::nearestIndices(table_, colors + first, n, indices);
+    for (int i = 0; i < n; ++i) out[first + i] = colors_[indices[i] < 0 ? 0 : indices[i]];
+  }
+}
 
+bool Pallete::isGrayScale() const {
+  if (colors_.empty()) return false;
+  const float epsilon = 1e-6f;
   for (const auto& palleteColor : colors_) {
-    float dr = palleteColor.r - color.r;
-    float dg = palleteColor.g - color.g;
-    float db = palleteColor.b - color.b;
-    float distanceSq = dr * dr + dg * dg + db * db;
-
-    if (distanceSq < minDistanceSq) {
-      minDistanceSq = distanceSq;
-      closestColor = &palleteColor;
+    if (std::fabs(palleteColor.r - palleteColor.g) > epsilon || std::fabs(palleteColor.g - palleteColor.b) > epsilon) {
+      return false;
     }
   }
-  return *closestColor;
+  return true;
 }
 
 Pallete Pallete::createGrayScalePallete(int levels) {
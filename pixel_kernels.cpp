@@ -0,0 +1,502 @@
+//
+// Created by Dhruva Sharma on 18/2/25.
+//
+
+#include "headers/pixel_kernels.h"
+#include "headers/cpu_dispatch.h"
+#include <algorithm>
+#include <cfloat>
+#include <limits>
+
+namespace pixel_kernels {
+
+namespace {
+
+// Planes are padded to a whole AVX-512 register
+constexpr int kPlaneAlign = 16;
+
+// ---- Scalar ----
+
+void ColorsToGray8Scalar(const Color* in, unsigned char* out, int begin, int count) {
+    for (int i = begin; i < count; ++i) {
+        float mean = (in[i].r + in[i].g + in[i].b) / 3.0f;
+        mean = std::max(0.0f, std::min(1.0f, mean));
+        out[i] = static_cast<unsigned char>(mean * 255.0f + 0.5f);
+    }
+}
+
+void ColorsToRgba8Scalar(const Color* in, unsigned char* out, int begin, int count) {
+    const float* values = &in[0].r;
+    for (int i = begin * 4; i < count * 4; ++i) {
+        out[i] = static_cast<unsigned char>(std::max(0.0f, std::min(1.0f, values[i])) * 255.0f);
+    }
+}
+
+void Rgba8ToColorsScalar(const unsigned char* in, Color* out, int begin, int count) {
+    float* values = &out[0].r;
+    for (int i = begin * 4; i < count * 4; ++i) values[i] = static_cast<float>(in[i]) / 255.0f;
+}
+
+// Same test as Pallete::GetClosestColor always did: strictly below the best so far, from FLT_MAX
+int NearestScalar(const PaletteTable& table, const Color& color) {
+    const float* r = table.plane(0);
+    const float* g = table.plane(1);
+    const float* b = table.plane(2);
+    float best = FLT_MAX;
+    int index = -1;
+    for (int e = 0; e < table.size(); ++e) {
+        float dr = r[e] - color.r;
+        float dg = g[e] - color.g;
+        float db = b[e] - color.b;
+        float distance = dr * dr + dg * dg + db * db;
+        if (distance < best) {
+            best = distance;
+            index = e;
+        }
+    }
+    return index;
+}
+
+void NearestRowScalar(const PaletteTable& table, const Color* colors, int begin, int count, int* out) {
+    for (int i = begin; i < count; ++i) out[i] = NearestScalar(table, colors[i]);
+}
+
+// Lanes of an entry-parallel search each keep the first best of their own entries; the overall
+// winner is the smallest distance, and the lowest entry among equal distances.
+int ReduceLanes(const float* best, const int* index, int lanes) {
+    int winner = -1;
+    float winning = FLT_MAX;
+    for (int lane = 0; lane < lanes; ++lane) {
+        if (index[lane] < 0) continue;
+        if (winner < 0 || best[lane] < winning || (best[lane] == winning && index[lane] < winner)) {
+            winning = best[lane];
+            winner = index[lane];
+        }
+    }
+    return winner;
+}
+
+#ifdef CPU_DISPATCH_X86
+
+// ---- SSE4.2: 4 pixels per register ----
+
+__attribute__((target("sse4.2")))
+inline void LoadPlanesSse(const Color* in, __m128& r, __m128& g, __m128& b) {
+    __m128 p0 = _mm_loadu_ps(&in[0].r);
+    __m128 p1 = _mm_loadu_ps(&in[1].r);
+    __m128 p2 = _mm_loadu_ps(&in[2].r);
+    __m128 p3 = _mm_loadu_ps(&in[3].r);
+    _MM_TRANSPOSE4_PS(p0, p1, p2, p3);
+    r = p0;
+    g = p1;
+    b = p2;
+}
+
+__attribute__((target("sse4.2")))
+inline __m128i GrayLevelsSse(const Color* in) {
+    __m128 r, g, b;
+    LoadPlanesSse(in, r, g, b);
+    __m128 mean = _mm_div_ps(_mm_add_ps(_mm_add_ps(r, g), b), _mm_set1_ps(3.0f));
+    // min returns its second operand for NaN, matching std::min(1.0f, mean)
+    mean = _mm_max_ps(_mm_min_ps(mean, _mm_set1_ps(1.0f)), _mm_setzero_ps());
+    return _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(mean, _mm_set1_ps(255.0f)), _mm_set1_ps(0.5f)));
+}
+
+__attribute__((target("sse4.2")))
+void ColorsToGray8Sse(const Color* in, unsigned char* out, int count) {
+    int i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m128i low = _mm_packs_epi32(GrayLevelsSse(in + i), GrayLevelsSse(in + i + 4));
+        __m128i high = _mm_packs_epi32(GrayLevelsSse(in + i + 8), GrayLevelsSse(in + i + 12));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_packus_epi16(low, high));
+    }
+    ColorsToGray8Scalar(in, out, i, count);
+}
+
+__attribute__((target("sse4.2")))
+inline __m128i ChannelBytesSse(const float* values) {
+    __m128 v = _mm_max_ps(_mm_min_ps(_mm_loadu_ps(values), _mm_set1_ps(1.0f)), _mm_setzero_ps());
+    return _mm_cvttps_epi32(_mm_mul_ps(v, _mm_set1_ps(255.0f)));
+}
+
+__attribute__((target("sse4.2")))
+void ColorsToRgba8Sse(const Color* in, unsigned char* out, int count) {
+    const float* values = &in[0].r;
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const float* v = values + i * 4;
+        __m128i low = _mm_packs_epi32(ChannelBytesSse(v), ChannelBytesSse(v + 4));
+        __m128i high = _mm_packs_epi32(ChannelBytesSse(v + 8), ChannelBytesSse(v + 12));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i * 4), _mm_packus_epi16(low, high));
+    }
+    ColorsToRgba8Scalar(in, out, i, count);
+}
+
+__attribute__((target("sse4.2")))
+void Rgba8ToColorsSse(const unsigned char* in, Color* out, int count) {
+    float* values = &out[0].r;
+    const __m128 scale = _mm_set1_ps(255.0f);
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i * 4));
+        for (int part = 0; part < 4; ++part) {
+            __m128i words = _mm_cvtepu8_epi32(bytes);
+            _mm_storeu_ps(values + i * 4 + part * 4, _mm_div_ps(_mm_cvtepi32_ps(words), scale));
+            bytes = _mm_srli_si128(bytes, 4);
+        }
+    }
+    Rgba8ToColorsScalar(in, out, i, count);
+}
+
+__attribute__((target("sse4.2")))
+int NearestSse(const PaletteTable& table, const Color& color) {
+    const __m128 cr = _mm_set1_ps(color.r), cg = _mm_set1_ps(color.g), cb = _mm_set1_ps(color.b);
+    __m128 best = _mm_set1_ps(FLT_MAX);
+    __m128i index = _mm_set1_epi32(-1);
+    __m128i entry = _mm_setr_epi32(0, 1, 2, 3);
+    int entries = std::min(table.padded(), (table.size() + 3) & ~3);
+    for (int e = 0; e < entries; e += 4) {
+        __m128 dr = _mm_sub_ps(_mm_loadu_ps(table.plane(0) + e), cr);
+        __m128 dg = _mm_sub_ps(_mm_loadu_ps(table.plane(1) + e), cg);
+        __m128 db = _mm_sub_ps(_mm_loadu_ps(table.plane(2) + e), cb);
+        __m128 distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dr, dr), _mm_mul_ps(dg, dg)), _mm_mul_ps(db, db));
+        __m128 closer = _mm_cmplt_ps(distance, best);
+        best = _mm_blendv_ps(best, distance, closer);
+        index = _mm_castps_si128(_mm_blendv_ps(_mm_castsi128_ps(index), _mm_castsi128_ps(entry), closer));
+        entry = _mm_add_epi32(entry, _mm_set1_epi32(4));
+    }
+    alignas(16) float bests[4];
+    alignas(16) int indices[4];
+    _mm_store_ps(bests, best);
+    _mm_store_si128(reinterpret_cast<__m128i*>(indices), index);
+    return ReduceLanes(bests, indices, 4);
+}
+
+__attribute__((target("sse4.2")))
+void NearestRowSse(const PaletteTable& table, const Color* colors, int count, int* out) {
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128 r, g, b;
+        LoadPlanesSse(colors + i, r, g, b);
+        __m128 best = _mm_set1_ps(FLT_MAX);
+        __m128i index = _mm_set1_epi32(-1);
+        for (int e = 0; e < table.size(); ++e) {
+            __m128 dr = _mm_sub_ps(_mm_set1_ps(table.plane(0)[e]), r);
+            __m128 dg = _mm_sub_ps(_mm_set1_ps(table.plane(1)[e]), g);
+            __m128 db = _mm_sub_ps(_mm_set1_ps(table.plane(2)[e]), b);
+            __m128 distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dr, dr), _mm_mul_ps(dg, dg)), _mm_mul_ps(db, db));
+            __m128 closer = _mm_cmplt_ps(distance, best);
+            best = _mm_blendv_ps(best, distance, closer);
+            index = _mm_castps_si128(_mm_blendv_ps(_mm_castsi128_ps(index),
+                                                   _mm_castsi128_ps(_mm_set1_epi32(e)), closer));
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), index);
+    }
+    NearestRowScalar(table, colors, i, count, out);
+}
+
+// ---- AVX2: 8 pixels per register ----
+
+// Pixels 0-3 in the low lane and 4-7 in the high lane after an in-lane 4x4 transpose
+__attribute__((target("avx2")))
+inline void LoadPlanesAvx2(const Color* in, __m256& r, __m256& g, __m256& b) {
+    __m256 p[4];
+    for (int k = 0; k < 4; ++k) {
+        p[k] = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(&in[k].r)), _mm_loadu_ps(&in[k + 4].r), 1);
+    }
+    __m256 rg01 = _mm256_unpacklo_ps(p[0], p[1]);
+    __m256 ba01 = _mm256_unpackhi_ps(p[0], p[1]);
+    __m256 rg23 = _mm256_unpacklo_ps(p[2], p[3]);
+    __m256 ba23 = _mm256_unpackhi_ps(p[2], p[3]);
+    r = _mm256_shuffle_ps(rg01, rg23, _MM_SHUFFLE(1, 0, 1, 0));
+    g = _mm256_shuffle_ps(rg01, rg23, _MM_SHUFFLE(3, 2, 3, 2));
+    b = _mm256_shuffle_ps(ba01, ba23, _MM_SHUFFLE(1, 0, 1, 0));
+}
+
+__attribute__((target("avx2")))
+void ColorsToGray8Avx2(const Color* in, unsigned char* out, int count) {
+    const __m256i gather = _mm256_setr_epi32(0, 4, 0, 0, 0, 0, 0, 0);
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256 r, g, b;
+        LoadPlanesAvx2(in + i, r, g, b);
+        __m256 mean = _mm256_div_ps(_mm256_add_ps(_mm256_add_ps(r, g), b), _mm256_set1_ps(3.0f));
+        mean = _mm256_max_ps(_mm256_min_ps(mean, _mm256_set1_ps(1.0f)), _mm256_setzero_ps());
+        __m256i levels = _mm256_cvttps_epi32(_mm256_add_ps(_mm256_mul_ps(mean, _mm256_set1_ps(255.0f)),
+                                                           _mm256_set1_ps(0.5f)));
+        // Packing works per 128-bit lane; the bytes end up in dwords 0 and 4
+        __m256i words = _mm256_packs_epi32(levels, levels);
+        __m256i bytes = _mm256_packus_epi16(words, words);
+        bytes = _mm256_permutevar8x32_epi32(bytes, gather);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(out + i), _mm256_castsi256_si128(bytes));
+    }
+    ColorsToGray8Scalar(in, out, i, count);
+}
+
+__attribute__((target("avx2")))
+inline __m256i ChannelBytesAvx2(const float* values) {
+    __m256 v = _mm256_max_ps(_mm256_min_ps(_mm256_loadu_ps(values), _mm256_set1_ps(1.0f)), _mm256_setzero_ps());
+    return _mm256_cvttps_epi32(_mm256_mul_ps(v, _mm256_set1_ps(255.0f)));
+}
+
+__attribute__((target("avx2")))
+void ColorsToRgba8Avx2(const Color* in, unsigned char* out, int count) {
+    const float* values = &in[0].r;
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const float* v = values + i * 4;
+        __m256i words = _mm256_packs_epi32(ChannelBytesAvx2(v), ChannelBytesAvx2(v + 8));
+        words = _mm256_permute4x64_epi64(words, 0xD8);
+        __m128i bytes = _mm_packus_epi16(_mm256_castsi256_si128(words), _mm256_extracti128_si256(words, 1));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i * 4), bytes);
+    }
+    ColorsToRgba8Scalar(in, out, i, count);
+}
+
+__attribute__((target("avx2")))
+void Rgba8ToColorsAvx2(const unsigned char* in, Color* out, int count) {
+    float* values = &out[0].r;
+    const __m256 scale = _mm256_set1_ps(255.0f);
+    int i = 0;
+    for (; i + 2 <= count; i += 2) {
+        __m128i bytes = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(in + i * 4));
+        _mm256_storeu_ps(values + i * 4, _mm256_div_ps(_mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(bytes)), scale));
+    }
+    Rgba8ToColorsScalar(in, out, i, count);
+}
+
+__attribute__((target("avx2")))
+int NearestAvx2(const PaletteTable& table, const Color& color) {
+    const __m256 cr = _mm256_set1_ps(color.r), cg = _mm256_set1_ps(color.g), cb = _mm256_set1_ps(color.b);
+    __m256 best = _mm256_set1_ps(FLT_MAX);
+    __m256i index = _mm256_set1_epi32(-1);
+    __m256i entry = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    int entries = std::min(table.padded(), (table.size() + 7) & ~7);
+    for (int e = 0; e < entries; e += 8) {
+        __m256 dr = _mm256_sub_ps(_mm256_loadu_ps(table.plane(0) + e), cr);
+        __m256 dg = _mm256_sub_ps(_mm256_loadu_ps(table.plane(1) + e), cg);
+        __m256 db = _mm256_sub_ps(_mm256_loadu_ps(table.plane(2) + e), cb);
+        __m256 distance = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(dr, dr), _mm256_mul_ps(dg, dg)),
+                                        _mm256_mul_ps(db, db));
+        __m256 closer = _mm256_cmp_ps(distance, best, _CMP_LT_OQ);
+        best = _mm256_blendv_ps(best, distance, closer);
+        index = _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(index), _mm256_castsi256_ps(entry), closer));
+        entry = _mm256_add_epi32(entry, _mm256_set1_epi32(8));
+    }
+    alignas(32) float bests[8];
+    alignas(32) int indices[8];
+    _mm256_store_ps(bests, best);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(indices), index);
+    return ReduceLanes(bests, indices, 8);
+}
+
+__attribute__((target("avx2")))
+void NearestRowAvx2(const PaletteTable& table, const Color* colors, int count, int* out) {
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256 r, g, b;
+        LoadPlanesAvx2(colors + i, r, g, b);
+        __m256 best = _mm256_set1_ps(FLT_MAX);
+        __m256i index = _mm256_set1_epi32(-1);
+        for (int e = 0; e < table.size(); ++e) {
+            __m256 dr = _mm256_sub_ps(_mm256_set1_ps(table.plane(0)[e]), r);
+            __m256 dg = _mm256_sub_ps(_mm256_set1_ps(table.plane(1)[e]), g);
+            __m256 db = _mm256_sub_ps(_mm256_set1_ps(table.plane(2)[e]), b);
+            __m256 distance = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(dr, dr), _mm256_mul_ps(dg, dg)),
+                                            _mm256_mul_ps(db, db));
+            __m256 closer = _mm256_cmp_ps(distance, best, _CMP_LT_OQ);
+            best = _mm256_blendv_ps(best, distance, closer);
+            index = _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(index),
+                                                         _mm256_castsi256_ps(_mm256_set1_epi32(e)), closer));
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), index);
+    }
+    NearestRowScalar(table, colors, i, count, out);
+}
+
+// ---- AVX-512: 16 pixels per register ----
+
+// Pixels 4k..4k+3 in lane k after an in-lane 4x4 transpose
+__attribute__((target("avx512f,avx512bw")))
+inline void LoadPlanesAvx512(const Color* in, __m512& r, __m512& g, __m512& b) {
+    __m512 p[4];
+    for (int k = 0; k < 4; ++k) {
+        __m512 v = _mm512_castps128_ps512(_mm_loadu_ps(&in[k].r));
+        v = _mm512_insertf32x4(v, _mm_loadu_ps(&in[k + 4].r), 1);
+        v = _mm512_insertf32x4(v, _mm_loadu_ps(&in[k + 8].r), 2);
+        p[k] = _mm512_insertf32x4(v, _mm_loadu_ps(&in[k + 12].r), 3);
+    }
+    __m512 rg01 = _mm512_unpacklo_ps(p[0], p[1]);
+    __m512 ba01 = _mm512_unpackhi_ps(p[0], p[1]);
+    __m512 rg23 = _mm512_unpacklo_ps(p[2], p[3]);
+    __m512 ba23 = _mm512_unpackhi_ps(p[2], p[3]);
+    r = _mm512_shuffle_ps(rg01, rg23, _MM_SHUFFLE(1, 0, 1, 0));
+    g = _mm512_shuffle_ps(rg01, rg23, _MM_SHUFFLE(3, 2, 3, 2));
+    b = _mm512_shuffle_ps(ba01, ba23, _MM_SHUFFLE(1, 0, 1, 0));
+}
+
+__attribute__((target("avx512f,avx512bw")))
+void ColorsToGray8Avx512(const Color* in, unsigned char* out, int count) {
+    int i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m512 r, g, b;
+        LoadPlanesAvx512(in + i, r, g, b);
+        __m512 mean = _mm512_div_ps(_mm512_add_ps(_mm512_add_ps(r, g), b), _mm512_set1_ps(3.0f));
+        mean = _mm512_max_ps(_mm512_min_ps(mean, _mm512_set1_ps(1.0f)), _mm512_setzero_ps());
+        __m512i levels = _mm512_cvttps_epi32(_mm512_add_ps(_mm512_mul_ps(mean, _mm512_set1_ps(255.0f)),
+                                                           _mm512_set1_ps(0.5f)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm512_cvtusepi32_epi8(levels));
+    }
+    ColorsToGray8Scalar(in, out, i, count);
+}
+
+__attribute__((target("avx512f,avx512bw")))
+void ColorsToRgba8Avx512(const Color* in, unsigned char* out, int count) {
+    const float* values = &in[0].r;
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m512 v = _mm512_loadu_ps(values + i * 4);
+        v = _mm512_max_ps(_mm512_min_ps(v, _mm512_set1_ps(1.0f)), _mm512_setzero_ps());
+        __m512i bytes = _mm512_cvttps_epi32(_mm512_mul_ps(v, _mm512_set1_ps(255.0f)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i * 4), _mm512_cvtusepi32_epi8(bytes));
+    }
+    ColorsToRgba8Scalar(in, out, i, count);
+}
+
+__attribute__((target("avx512f,avx512bw")))
+void Rgba8ToColorsAvx512(const unsigned char* in, Color* out, int count) {
+    float* values = &out[0].r;
+    const __m512 scale = _mm512_set1_ps(255.0f);
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i * 4));
+        _mm512_storeu_ps(values + i * 4, _mm512_div_ps(_mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(bytes)), scale));
+    }
+    Rgba8ToColorsScalar(in, out, i, count);
+}
+
+__attribute__((target("avx512f,avx512bw")))
+int NearestAvx512(const PaletteTable& table, const Color& color) {
+    const __m512 cr = _mm512_set1_ps(color.r), cg = _mm512_set1_ps(color.g), cb = _mm512_set1_ps(color.b);
+    __m512 best = _mm512_set1_ps(FLT_MAX);
+    __m512i index = _mm512_set1_epi32(-1);
+    __m512i entry = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    for (int e = 0; e < table.padded(); e += 16) {
+        __m512 dr = _mm512_sub_ps(_mm512_loadu_ps(table.plane(0) + e), cr);
+        __m512 dg = _mm512_sub_ps(_mm512_loadu_ps(table.plane(1) + e), cg);
+        __m512 db = _mm512_sub_ps(_mm512_loadu_ps(table.plane(2) + e), cb);
+        __m512 distance = _mm512_add_ps(_mm512_add_ps(_mm512_mul_ps(dr, dr), _mm512_mul_ps(dg, dg)),
+                                        _mm512_mul_ps(db, db));
+        __mmask16 closer = _mm512_cmp_ps_mask(distance, best, _CMP_LT_OQ);
+        best = _mm512_mask_mov_ps(best, closer, distance);
+        index = _mm512_mask_mov_epi32(index, closer, entry);
+        entry = _mm512_add_epi32(entry, _mm512_set1_epi32(16));
+    }
+    alignas(64) float bests[16];
+    alignas(64) int indices[16];
+    _mm512_store_ps(bests, best);
+    _mm512_store_si512(indices, index);
+    return ReduceLanes(bests, indices, 16);
+}
+
+__attribute__((target("avx512f,avx512bw")))
+void NearestRowAvx512(const PaletteTable& table, const Color* colors, int count, int* out) {
+    int i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m512 r, g, b;
+        LoadPlanesAvx512(colors + i, r, g, b);
+        __m512 best = _mm512_set1_ps(FLT_MAX);
+        __m512i index = _mm512_set1_epi32(-1);
+        for (int e = 0; e < table.size(); ++e) {
+            __m512 dr = _mm512_sub_ps(_mm512_set1_ps(table.plane(0)[e]), r);
+            __m512 dg = _mm512_sub_ps(_mm512_set1_ps(table.plane(1)[e]), g);
+            __m512 db = _mm512_sub_ps(_mm512_set1_ps(table.plane(2)[e]), b);
+            __m512 distance = _mm512_add_ps(_mm512_add_ps(_mm512_mul_ps(dr, dr), _mm512_mul_ps(dg, dg)),
+                                            _mm512_mul_ps(db, db));
+            __mmask16 closer = _mm512_cmp_ps_mask(distance, best, _CMP_LT_OQ);
+            best = _mm512_mask_mov_ps(best, closer, distance);
+            index = _mm512_mask_mov_epi32(index, closer, _mm512_set1_epi32(e));
+        }
+        _mm512_storeu_si512(out + i, index);
+    }
+    NearestRowScalar(table, colors, i, count, out);
+}
+
+#endif
+
+struct Kernels {
+    void (*toGray8)(const Color*, unsigned char*, int);
+    void (*toRgba8)(const Color*, unsigned char*, int);
+    void (*fromRgba8)(const unsigned char*, Color*, int);
+    int (*nearest)(const PaletteTable&, const Color&);
+    void (*nearestRow)(const PaletteTable&, const Color*, int, int*);
+};
+
+Kernels SelectKernels() {
+    Kernels kernels = {
+        [](const Color* in, unsigned char* out, int count) { ColorsToGray8Scalar(in, out, 0, count); },
+        [](const Color* in, unsigned char* out, int count) { ColorsToRgba8Scalar(in, out, 0, count); },
+        [](const unsigned char* in, Color* out, int count) { Rgba8ToColorsScalar(in, out, 0, count); },
+        NearestScalar,
+        [](const PaletteTable& table, const Color* colors, int count, int* out) {
+            NearestRowScalar(table, colors, 0, count, out);
+        },
+    };
+#ifdef CPU_DISPATCH_X86
+    switch (cpu_dispatch::activeIsa()) {
+        case cpu_dispatch::Isa::AVX512:
+            kernels = {ColorsToGray8Avx512, ColorsToRgba8Avx512, Rgba8ToColorsAvx512, NearestAvx512, NearestRowAvx512};
+            break;
+        case cpu_dispatch::Isa::AVX2:
+            kernels = {ColorsToGray8Avx2, ColorsToRgba8Avx2, Rgba8ToColorsAvx2, NearestAvx2, NearestRowAvx2};
+            break;
+        case cpu_dispatch::Isa::SSE42:
+            kernels = {ColorsToGray8Sse, ColorsToRgba8Sse, Rgba8ToColorsSse, NearestSse, NearestRowSse};
+            break;
+        default:
+            break;
+    }
+#endif
+    return kernels;
+}
+
+const Kernels& Bound() {
+    static const Kernels kernels = SelectKernels();
+    return kernels;
+}
+
+}
+
+PaletteTable::PaletteTable(const std::vector<Color>& colors)
+    : size_(static_cast<int>(colors.size())),
+      padded_((size_ + kPlaneAlign - 1) / kPlaneAlign * kPlaneAlign),
+      planes_(static_cast<size_t>(padded_) * 3, std::numeric_limits<float>::quiet_NaN()) {
+    // NaN padding never compares below the best distance, so it can never be picked
+    for (int e = 0; e < size_; ++e) {
+        planes_[e] = colors[e].r;
+        planes_[padded_ + e] = colors[e].g;
+        planes_[2 * static_cast<size_t>(padded_) + e] = colors[e].b;
+    }
+}
+
+void colorsToGray8(const Color* in, unsigned char* out, int count) {
+    Bound().toGray8(in, out, count);
+}
+
+void colorsToRgba8(const Color* in, unsigned char* out, int count) {
+    Bound().toRgba8(in, out, count);
+}
+
+void rgba8ToColors(const unsigned char* in, Color* out, int count) {
+    Bound().fromRgba8(in, out, count);
+}
+
+int nearestIndex(const PaletteTable& table, const Color& color) {
+    return Bound().nearest(table, color);
+}
+
+void nearestIndices(const PaletteTable& table, const Color* colors, int count, int* out) {
+    Bound().nearestRow(table, colors, count, out);
+}
+
+}
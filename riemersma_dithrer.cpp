@@ -0,0 +1,126 @@
+//
+// Created by Dhruva Sharma on 18/2/25.
+//
+
+#include "headers/riemersma_dithrer.h"
+#include "headers/gray_pipeline.h"
+#include "headers/thread_pool.h"
+#include <algorithm>
+#include <cmath>
+
+RiemersmaDithrer::RiemersmaDithrer(int blockSize, int historyLength, float ratio) {
+  // The Hilbert curve needs a power-of-two block
+  blockSize_ = 2;
+  while (blockSize_ < blockSize && blockSize_ < 4096) blockSize_ *= 2;
+  historyLength_ = std::max(1, historyLength);
+  ratio = std::max(1e-6f, std::min(1.0f, ratio));
+  decay_ = historyLength_ > 1 ? std::pow(ratio, 1.0f / (historyLength_ - 1)) : 1.0f;
+  oldestWeight_ = std::pow(decay_, static_cast<float>(historyLength_));
+  GenerateCurve();
+}
+
+void RiemersmaDithrer::GenerateCurve() {
+  int count = blockSize_ * blockSize_;
+  curve_.resize(count);
+  for (int d = 0; d < count; ++d) {
+    // Hilbert index to coordinates, one quadrant level per step
+    int x = 0, y = 0, t = d;
+    for (int s = 1; s < blockSize_; s *= 2) {
+      int rx = 1 & (t / 2);
+      int ry = 1 & (t ^ rx);
+      if (ry == 0) {
+        if (rx == 1) {
+          x = s - 1 - x;
+          y = s - 1 - y;
+        }
+        std::swap(x, y);
+      }
+      x += s * rx;
+      y += s * ry;
+      t /= 4;
+    }
+    curve_[d] = x + y * blockSize_;
+  }
+}
+
+// Walks one block along the curve. As in Riemersma's algorithm, the history holds original pixel
+// minus output, so the output of a flat region tracks its mean instead of feeding on its own
+// corrections. The weighted sum is kept incrementally, already divided by the newest (largest) weight:
+// sum' = error + decay * sum - decay^length * (error leaving the history).
+template <int Channels, typename Quantize>
+static void DiffuseBlock(const std::vector<int>& curve, int blockSize, int blockX, int blockY,
+                         int width, int height, int historyLength, float decay, float oldestWeight,
+                         const float* values, Quantize quantize) {
+  std::vector<float> history(static_cast<size_t>(historyLength) * Channels, 0.0f);
+  float sum[Channels] = {};
+  int head = 0;
+  for (int packed : curve) {
+    int x = blockX + packed % blockSize;
+    int y = blockY + packed / blockSize;
+    if (x >= width || y >= height) continue;
+
+    const float* value = values + (static_cast<size_t>(y) * width + x) * Channels;
+    float adjusted[Channels];
+    for (int c = 0; c < Channels; ++c) adjusted[c] = value[c] + sum[c];
+    float output[Channels];
+    quantize(x, y, adjusted, output);
+
+    float* slot = history.data() + static_cast<size_t>(head) * Channels;
+    for (int c = 0; c < Channels; ++c) {
+      float error = value[c] - output[c];
+      sum[c] = error + decay * sum[c] - oldestWeight * slot[c];
+      slot[c] = error;
+    }
+    head = (head + 1) % historyLength;
+  }
+}
+
+void RiemersmaDithrer::applyDither(const Image& inputImage, Image& outputImage, const Pallete& pallete) {
+  int width = inputImage.getWidth();
+  int height = inputImage.getHeight();
+
+  if (gray_pipeline::canUse(pallete)) {
+    std::vector<unsigned char> gray = gray_pipeline::decodeGray8(inputImage);
+    std::vector<float> values(gray.begin(), gray.end());
+    std::vector<unsigned char> indices(gray.size());
+    gray_pipeline::GrayLevels levels(pallete);
+    auto quantize = [&](int x, int y, const float* value, float* output) {
+      int index = levels.closestIndex(value[0]);
+      indices[static_cast<size_t>(y) * width + x] = static_cast<unsigned char>(index);
+      output[0] = levels.level(index);
+    };
+    // The history restarts with every block, so blocks are independent
+    thread_pool::parallelForTiles(width, height, blockSize_, blockSize_, [&](int blockX, int blockY, int, int) {
+      DiffuseBlock<1>(curve_, blockSize_, blockX, blockY, width, height, historyLength_,
+                      decay_, oldestWeight_, values.data(), quantize);
+    });
+    gray_pipeline::emitIndices(indices, width, height, pallete, outputImage);
+    return;
+  }
+
+  outputImage = inputImage;
+  std::vector<float> values(static_cast<size_t>(width) * height * 3);
+  thread_pool::parallelFor(0, height, 0, [&](int first, int last) {
+    for (int y = first; y < last; ++y) {
+      const Color* row = inputImage.getRow(y);
+      float* out = values.data() + static_cast<size_t>(y) * width * 3;
+      for (int x = 0; x < width; ++x) {
+        out[x * 3 + 0] = row[x].r;
+        out[x * 3 + 1] = row[x].g;
+        out[x * 3 + 2] = row[x].b;
+      }
+    }
+  });
+  auto quantize = [&](int x, int y, const float* value, float* output) {
+    Color oldColor(value[0], value[1], value[2]);
+    const Color& newColor = pallete.GetClosestColor(oldColor);
+    outputImage.getRow(y)[x] = newColor;
+    output[0] = newColor.r;
+    output[1] = newColor.g;
+    output[2] = newColor.b;
+  };
+  thread_pool::parallelForTiles(width, height, blockSize_, blockSize_, [&](int blockX, int blockY, int, int) {
+    DiffuseBlock<3>(curve_, blockSize_, blockX, blockY, width, height, historyLength_,
+                    decay_, oldestWeight_, values.data(), quantize);
+  });
+}
@@ -0,0 +1,84 @@
+//
+// Created by Dhruva Sharma on 18/2/25.
+//
+
+#include "headers/summed_area_table.h"
+#include "headers/thread_pool.h"
+#include <algorithm>
+
+void SummedAreaTable::build(const float* plane, int width, int height) {
+    width_ = std::max(0, width);
+    height_ = std::max(0, height);
+    size_t stride = static_cast<size_t>(width_) + 1;
+    sums_.assign(stride * (height_ + 1), 0.0);
+    squares_.assign(stride * (height_ + 1), 0.0);
+
+    // Every row's running sum is independent
+    thread_pool::parallelFor(0, height_, 0, [&](int first, int last) {
+        for (int y = first; y < last; ++y) {
+            const float* in = plane + static_cast<size_t>(y) * width_;
+            double* sum = sums_.data() + (y + 1) * stride + 1;
+            double* square = squares_.data() + (y + 1) * stride + 1;
+            double runningSum = 0.0, runningSquare = 0.0;
+            for (int x = 0; x < width_; ++x) {
+                runningSum += in[x];
+                runningSquare += static_cast<double>(in[x]) * in[x];
+                sum[x] = runningSum;
+                square[x] = runningSquare;
+            }
+        }
+    });
+    // Then each band of columns walks down the rows on its own
+    thread_pool::parallelFor(1, width_ + 1, 0, [&](int first, int last) {
+        for (int y = 2; y <= height_; ++y) {
+            const double* sumAbove = sums_.data() + (y - 1) * stride;
+            const double* squareAbove = squares_.data() + (y - 1) * stride;
+            double* sum = sums_.data() + y * stride;
+            double* square = squares_.data() + y * stride;
+            for (int x = first; x < last; ++x) {
+                sum[x] += sumAbove[x];
+                square[x] += squareAbove[x];
+            }
+        }
+    });
+}
+
+bool SummedAreaTable::Clip(int& x0, int& y0, int& x1, int& y1) const {
+    x0 = std::max(x0, 0);
+    y0 = std::max(y0, 0);
+    x1 = std::min(x1, width_);
+    y1 = std::min(y1, height_);
+    return x0 < x1 && y0 < y1;
+}
+
+double SummedAreaTable::Lookup(const std::vector<double>& table, int x0, int y0, int x1, int y1) const {
+    if (!Clip(x0, y0, x1, y1)) return 0.0;
+    size_t stride = static_cast<size_t>(width_) + 1;
+    return table[y1 * stride + x1] - table[y0 * stride + x1] - table[y1 * stride + x0] + table[y0 * stride + x0];
+}
+
+int SummedAreaTable::count(int x0, int y0, int x1, int y1) const {
+    if (!Clip(x0, y0, x1, y1)) return 0;
+    return (x1 - x0) * (y1 - y0);
+}
+
+double SummedAreaTable::sum(int x0, int y0, int x1, int y1) const {
+    return Lookup(sums_, x0, y0, x1, y1);
+}
+
+double SummedAreaTable::sumOfSquares(int x0, int y0, int x1, int y1) const {
+    return Lookup(squares_, x0, y0, x1, y1);
+}
+
+float SummedAreaTable::mean(int x0, int y0, int x1, int y1) const {
+    int n = count(x0, y0, x1, y1);
+    return n > 0 ? static_cast<float>(sum(x0, y0, x1, y1) / n) : 0.0f;
+}
+
+float SummedAreaTable::variance(int x0, int y0, int x1, int y1) const {
+    int n = count(x0, y0, x1, y1);
+    if (n == 0) return 0.0f;
+    double mean = sum(x0, y0, x1, y1) / n;
+    // Cancellation can leave a tiny negative value for a flat rectangle
+    return static_cast<float>(std::max(0.0, sumOfSquares(x0, y0, x1, y1) / n - mean * mean));
+}
@@ -0,0 +1,149 @@
+//
+// Created by Dhruva Sharma on 18/2/25.
+//
+
+#include "headers/Image.h"
+#include "headers/ascii_dithrer.h"
+#include "headers/gaussian_blur.h"
+#include "headers/pallete.h"
+#include "headers/floyd_dithrer.h"
+#include "headers/ostromoukhov_dithrer.h"
+#include "headers/riemersma_dithrer.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+static int failures = 0;
+
+static void check(bool condition, const std::string& what) {
+  if (!condition) {
+    std::cerr << "FAIL: " << what << "\n";
+    ++failures;
+  }
+}
+
+// Mean output level (0-255) of a flat gray field dithered to black and white
+static float FlatMean(Dither& dither, int level, int width, int height) {
+  float value = level / 255.0f;
+  Image input(width, height), output(width, height);
+  for (int y = 0; y < height; ++y) {
+    for (int x = 0; x < width; ++x) input.setPixel(x, y, Color(value, value, value));
+  }
+  dither.applyDither(input, output, Pallete::createGrayScalePallete(2));
+  double sum = 0.0;
+  for (int y = 0; y < height; ++y) {
+    const Color* row = output.getRow(y);
+    for (int x = 0; x < width; ++x) sum += row[x].r;
+  }
+  return static_cast<float>(sum / (static_cast<double>(width) * height) * 255.0);
+}
+
+// An error diffuser must keep the mean of a flat field. Riemersma only remembers the last few
+// errors, so it is held to the mid tones and a wider tolerance: its weighted history cannot build
+// up enough to flip a pixel in near-black or near-white fields, and flat fields fall into short
+// repeating patterns.
+static void TestFlatMeans() {
+  struct Case {
+    std::string name;
+    std::function<std::unique_ptr<Dither>()> make;
+    int first, last;
+    float tolerance;
+  };
+  const Case cases[] = {
+    {"Floyd-Steinberg", [] { return std::make_unique<FloydDithrer>(); }, 8, 248, 2.0f},
+    {"Ostromoukhov", [] { return std::make_unique<OstromoukhovDithrer>(); }, 8, 248, 2.0f},
+    {"Riemersma", [] { return std::make_unique<RiemersmaDithrer>(); }, 32, 224, 10.0f},
+  };
+  for (const Case& test : cases) {
+    std::unique_ptr<Dither> dither = test.make();
+    for (int level = test.first; level <= test.last; level += 8) {
+      float mean = FlatMean(*dither, level, 200, 150);
+      check(std::fabs(mean - level) <= test.tolerance,
+            test.name + ": flat " + std::to_string(level) + " came out at " + std::to_string(mean));
+    }
+  }
+}
+
+// Direct two-dimensional evaluation of blur(sigma1) - tau * blur(sigma2), with extended edges
+static std::vector<float> ReferenceDifference(const std::vector<float>& in, int width, int height,
+                                              float sigma1, float sigma2, float tau) {
+  auto blur = [&](float sigma) {
+    int radius = static_cast<int>(std::ceil(sigma * 3));
+    std::vector<float> out(in.size());
+    for (int y = 0; y < height; ++y) {
+      for (int x = 0; x < width; ++x) {
+        double sum = 0.0, norm = 0.0;
+        for (int dy = -radius; dy <= radius; ++dy) {
+          for (int dx = -radius; dx <= radius; ++dx) {
+            int sx = std::max(0, std::min(x + dx, width - 1));
+            int sy = std::max(0, std::min(y + dy, height - 1));
+            double weight = std::exp(-(dx * dx + dy * dy) / (2.0 * sigma * sigma));
+            sum += in[sy * width + sx] * weight;
+            norm += weight;
+          }
+        }
+        out[y * width + x] = static_cast<float>(sum / norm);
+      }
+    }
+    return out;
+  };
+  std::vector<float> blur1 = blur(sigma1), blur2 = blur(sigma2);
+  std::vector<float> out(in.size());
+  for (size_t i = 0; i < in.size(); ++i) out[i] = blur1[i] - tau * blur2[i];
+  return out;
+}
+
+// The DoG must index rows by the real width on images that are not square, wider or taller
+static void TestDifferenceOfGaussians() {
+  const int sizes[][2] = {{61, 17}, {13, 40}};
+  for (const auto& size : sizes) {
+    int width = size[0], height = size[1];
+    std::vector<float> in(static_cast<size_t>(width) * height);
+    for (int y = 0; y < height; ++y) {
+      for (int x = 0; x < width; ++x) in[y * width + x] = ((x * 7 + y * 13) % 17) / 16.0f + (x > width / 2 ? 0.5f : 0.0f);
+    }
+    std::vector<float> expected = ReferenceDifference(in, width, height, 1.0f, 1.6f, 0.9f);
+    std::vector<float> out(in.size());
+    gaussian_blur::difference(in.data(), out.data(), width, height, 1.0f, 1.6f, 0.9f);
+    float worst = 0.0f;
+    for (size_t i = 0; i < in.size(); ++i) worst = std::max(worst, std::fabs(out[i] - expected[i]));
+    check(worst < 1e-4f, "DoG of " + std::to_string(width) + "x" + std::to_string(height) +
+                             " is off by " + std::to_string(worst));
+  }
+}
+
+// With DoG edges on, a vertical step through a wide image shows up as '|' in the tiles along it.
+// The blurs spread the response a few pixels, so the neighboring tiles may show it too.
+static void TestDogEdges() {
+  int width = 96, height = 32;
+  Image input(width, height);
+  for (int y = 0; y < height; ++y) {
+    for (int x = 0; x < width; ++x) input.setPixel(x, y, x < 44 ? Color(0.1f, 0.1f, 0.1f) : Color(0.9f, 0.9f, 0.9f));
+  }
+  AsciiDithrer ascii(AsciiCharSet::BASIC, true);
+  ascii.setDogEdges(true);
+  std::string text;
+  check(ascii.renderAsTextAdvanced(input, text), "DoG edges: render failed");
+  // 12 tiles per row plus the newline; the step at x = 44 lies in tile column 5
+  bool edgesFound = text.size() == 13 * 4;
+  for (int row = 0; row < 4 && edgesFound; ++row) {
+    for (int column = 0; column < 12; ++column) {
+      bool isEdge = text[row * 13 + column] == '|';
+      if (column == 5 ? !isEdge : isEdge && std::abs(column - 5) > 1) edgesFound = false;
+    }
+  }
+  check(edgesFound, "DoG edges: expected a column of '|' around tile 5, got\n" + text);
+}
+
+int main() {
+  TestFlatMeans();
+  TestDifferenceOfGaussians();
+  TestDogEdges();
+  if (failures == 0) std::cout << "All tests passed\n";
+  return failures == 0 ? 0 : 1;
+}
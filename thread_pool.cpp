@@ -0,0 +1,233 @@
+//
+// Created by Dhruva Sharma on 18/2/25.
+//
+
+#include "headers/thread_pool.h"
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace thread_pool {
+
+namespace {
+
+using Task = std::function<void()>;
+
+class WorkQueue {
+  public:
+    void push(Task task) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        tasks_.push_back(std::move(task));
+    }
+    // The owner takes the newest task, which is the one most likely to still be in cache
+    bool popNewest(Task& task) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (tasks_.empty()) return false;
+        task = std::move(tasks_.back());
+        tasks_.pop_back();
+        return true;
+    }
+    // Thieves take the oldest, which for split loops is the largest remaining share
+    bool popOldest(Task& task) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (tasks_.empty()) return false;
+        task = std::move(tasks_.front());
+        tasks_.pop_front();
+        return true;
+    }
+
+  private:
+    std::mutex mutex_;
+    std::deque<Task> tasks_;
+};
+
+class Scheduler;
+
+// Which scheduler the current thread works for, and its queue there
+thread_local Scheduler* currentScheduler = nullptr;
+thread_local int currentWorker = -1;
+
+class Scheduler {
+  public:
+    explicit Scheduler(int threads) : threads_(threads) {
+        int workers = threads - 1;
+        // Queues 0 .. workers - 1 belong to the workers, the last one takes outside submissions
+        for (int i = 0; i <= workers; ++i) queues_.push_back(std::make_unique<WorkQueue>());
+        for (int i = 0; i < workers; ++i) workers_.emplace_back(&Scheduler::WorkerLoop, this, i);
+    }
+
+    ~Scheduler() {
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex_);
+            stopping_ = true;
+        }
+        wake_.notify_all();
+        for (auto& worker : workers_) worker.join();
+    }
+
+    int threads() const { return threads_; }
+
+    void submit(Task task) {
+        queued_.fetch_add(1);
+        queues_[OwnQueue()]->push(std::move(task));
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex_);
+        }
+        wake_.notify_one();
+    }
+
+    // Runs one queued task, if there is any
+    bool runOne() {
+        Task task;
+        if (!Take(currentScheduler == this ? currentWorker : -1, task)) return false;
+        task();
+        return true;
+    }
+
+  private:
+    int OwnQueue() const {
+        return currentScheduler == this ? currentWorker : static_cast<int>(workers_.size());
+    }
+
+    bool Take(int worker, Task& task) {
+        int workers = static_cast<int>(workers_.size());
+        bool found = (worker >= 0 && queues_[worker]->popNewest(task)) ||
+                     queues_[workers]->popOldest(task);
+        for (int k = 1; !found && k <= workers; ++k) {
+            int victim = worker >= 0 ? (worker + k) % workers : k - 1;
+            found = victim != worker && queues_[victim]->popOldest(task);
+        }
+        if (found) queued_.fetch_sub(1);
+        return found;
+    }
+
+    void WorkerLoop(int index) {
+        currentScheduler = this;
+        currentWorker = index;
+        Task task;
+        while (true) {
+            if (Take(index, task)) {
+                task();
+                task = nullptr;
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(sleepMutex_);
+            wake_.wait(lock, [this] { return stopping_ || queued_.load() > 0; });
+            if (stopping_ && queued_.load() <= 0) return;
+        }
+    }
+
+    int threads_;
+    std::vector<std::unique_ptr<WorkQueue>> queues_;
+    std::vector<std::thread> workers_;
+    std::mutex sleepMutex_;
+    std::condition_variable wake_;
+    std::atomic<int> queued_{0};
+    bool stopping_ = false;
+};
+
+std::mutex instanceMutex;
+std::unique_ptr<Scheduler> instance;
+int requestedThreads = 0;
+
+int ResolveThreads(int count) {
+    if (count <= 0) count = static_cast<int>(std::thread::hardware_concurrency());
+    return std::max(1, std::min(count, 256));
+}
+
+Scheduler& Instance() {
+    std::lock_guard<std::mutex> lock(instanceMutex);
+    if (!instance) instance = std::make_unique<Scheduler>(ResolveThreads(requestedThreads));
+    return *instance;
+}
+
+}
+
+void setThreadCount(int count) {
+    std::unique_ptr<Scheduler> previous;
+    {
+        std::lock_guard<std::mutex> lock(instanceMutex);
+        requestedThreads = count;
+        if (instance && instance->threads() == ResolveThreads(count)) return;
+        previous = std::move(instance);
+    }
+    // Joined outside the lock; the next parallel call starts the new workers
+}
+
+int threadCount() {
+    return Instance().threads();
+}
+
+TaskGroup::~TaskGroup() {
+    Drain();
+}
+
+void TaskGroup::run(std::function<void()> task) {
+    pending_.fetch_add(1);
+    Instance().submit([this, task = std::move(task)] {
+        try {
+            task();
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(errorMutex_);
+            if (!error_) error_ = std::current_exception();
+        }
+        pending_.fetch_sub(1, std::memory_order_release);
+    });
+}
+
+void TaskGroup::Drain() {
+    Scheduler& scheduler = Instance();
+    while (pending_.load(std::memory_order_acquire) > 0) {
+        if (!scheduler.runOne()) std::this_thread::yield();
+    }
+}
+
+void TaskGroup::wait() {
+    Drain();
+    std::exception_ptr error;
+    {
+        std::lock_guard<std::mutex> lock(errorMutex_);
+        std::swap(error, error_);
+    }
+    if (error) std::rethrow_exception(error);
+}
+
+void parallelFor(int begin, int end, int grain, const std::function<void(int, int)>& body) {
+    if (end <= begin) return;
+    int count = end - begin;
+    int threads = threadCount();
+    // A few chunks per thread leaves room for stealing when rows cost different amounts
+    if (grain <= 0) grain = std::max(1, count / (threads * 4));
+    if (threads == 1 || count <= grain) {
+        body(begin, end);
+        return;
+    }
+    TaskGroup group;
+    for (int first = begin + grain; first < end; first += grain) {
+        int last = first + std::min(grain, end - first);
+        group.run([&body, first, last] { body(first, last); });
+    }
+    body(begin, begin + grain);
+    group.wait();
+}
+
+void parallelForTiles(int width, int height, int tileWidth, int tileHeight,
+                      const std::function<void(int, int, int, int)>& body) {
+    if (width <= 0 || height <= 0) return;
+    tileWidth = std::max(1, tileWidth);
+    tileHeight = std::max(1, tileHeight);
+    int tilesX = (width + tileWidth - 1) / tileWidth;
+    int tilesY = (height + tileHeight - 1) / tileHeight;
+    parallelFor(0, tilesX * tilesY, 0, [&](int first, int last) {
+        for (int tile = first; tile < last; ++tile) {
+            int x0 = (tile % tilesX) * tileWidth;
+            int y0 = (tile / tilesX) * tileHeight;
+            body(x0, y0, std::min(width, x0 + tileWidth), std::min(height, y0 + tileHeight));
+        }
+    });
+}
+
+}
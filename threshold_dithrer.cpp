@@ -1,18 +1,56 @@
 #include "headers/threshold_dithrer.h"
+#include "headers/gray_pipeline.h"
+#include "headers/channel_levels.h"
+#include "headers/thread_pool.h"
 
-ThresholdDithrer::ThresholdDithrer(float threshold) : threshold_(threshold) {}
+ThresholdDithrer::ThresholdDithrer(float threshold) : threshold_(threshold) {
+    tile_ = ordered_kernels::tileThresholds(&threshold_, 1);
+}
 
 void ThresholdDithrer::applyDither(const Image& inputImage, Image& outputImage, const Pallete& pallete) {
     int width = inputImage.getWidth();
     int height = inputImage.getHeight();
-    outputImage = inputImage;
-    for (int y = 0; y < height; ++y) {
-        for (int x = 0; x < width; ++x) {
-            Color orig = inputImage.getPixel(x, y);
-            float lum = (orig.r + orig.g + orig.b) / 3.0f;
-            float newLum = lum > threshold_ ? 1.0f : 0.0f;
-            Color newColor = pallete.GetClosestColor(Color(newLum, newLum, newLum));
-            outputImage.setPixel(x, y, newColor);
+
+    if (gray_pipeline::canUse(pallete)) {
+        std::vector<unsigned char> gray = gray_pipeline::decodeGray8(inputImage);
+        gray_pipeline::GrayLevels levels(pallete);
+        std::vector<unsigned char> indices(gray.size());
+        ordered_kernels::UniformRamp ramp;
+        if (ordered_kernels::uniformRamp(levels, ramp)) {
+            thread_pool::parallelFor(0, height, 0, [&](int first, int last) {
+                size_t offset = static_cast<size_t>(first) * width;
+                ordered_kernels::ditherRow(gray.data() + offset, tile_.row(0), tile_.width,
+                                           indices.data() + offset, (last - first) * width, ramp);
+            });
+            gray_pipeline::emitIndices(indices, width, height, pallete, outputImage);
+            return;
+        }
+        // Each 8-bit level always lands on the same entry, so decide once per level
+        unsigned char lookup[256];
+        for (int v = 0; v < 256; ++v) {
+            const gray_pipeline::GrayLevels::Step& step = levels.step(static_cast<unsigned char>(v));
+            lookup[v] = step.fraction > threshold_ ? step.upper : step.lower;
         }
+        thread_pool::parallelFor(0, height, 0, [&](int first, int last) {
+            size_t end = static_cast<size_t>(last) * width;
+            for (size_t i = static_cast<size_t>(first) * width; i < end; ++i) {
+                indices[i] = lookup[gray[i]];
+            }
+        });
+        gray_pipeline::emitIndices(indices, width, height, pallete, outputImage);
+        return;
     }
+
+    outputImage = inputImage;
+    ChannelLevels levels(pallete);
+    thread_pool::parallelFor(0, height, 0, [&](int first, int last) {
+        for (int y = first; y < last; ++y) {
+            const Color* in = inputImage.getRow(y);
+            Color* out = outputImage.getRow(y);
+            for (int x = 0; x < width; ++x) {
+                out[x] = levels.spread(in[x], threshold_);
+            }
+            pallete.GetClosestColors(out, out, width);
+        }
+    });
 } 
\ No newline at end of file
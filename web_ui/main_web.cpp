@@ -5,7 +5,16 @@
 #include "../headers/ordered_dithrer.h"
 #include "../headers/threshold_dithrer.h"
 #include "../headers/ascii_dithrer.h"
+#include "../headers/dot_diffusion_dithrer.h"
+#include "../headers/ostromoukhov_dithrer.h"
+#include "../headers/riemersma_dithrer.h"
+#include "../headers/blue_noise_dithrer.h"
+#include "../headers/yliluoma_dithrer.h"
+#include "../headers/halftone_dithrer.h"
+#include "../headers/noise_dithrer.h"
 #include "../headers/pallete.h"
+#include "../headers/thread_pool.h"
+#include "../headers/cpu_dispatch.h"
 #include <memory>
 #include <string>
 #include <sstream>
@@ -123,10 +132,14 @@ std::unique_ptr<Dither> create_ditherer_from_json(const json& dither_json) {
     std::string algorithm = dither_json["algorithm"];
     
     if (algorithm == "floyd") {
-        return std::make_unique<FloydDithrer>();
+        auto ditherer = std::make_unique<FloydDithrer>();
+        ditherer->setSerpentine(dither_json.value("serpentine", false));
+        return ditherer;
     }
     else if (algorithm == "atkinson") {
-        return std::make_unique<AtkinsonDithrer>();
+        auto ditherer = std::make_unique<AtkinsonDithrer>();
+        ditherer->setSerpentine(dither_json.value("serpentine", false));
+        return ditherer;
     }
     else if (algorithm == "ordered") {
         int bayer_size = dither_json.value("bayer_size", 2);
@@ -141,11 +154,51 @@ std::unique_ptr<Dither> create_ditherer_from_json(const json& dither_json) {
         bool detect_edges = dither_json.value("detect_edges", true);
         return std::make_unique<AsciiDithrer>((AsciiCharSet)ascii_set, detect_edges);
     }
+    else if (algorithm == "dot") {
+        bool optimized = dither_json.value("optimized", false);
+        return std::make_unique<DotDiffusionDithrer>(optimized ? DotClassMatrix::OPTIMIZED : DotClassMatrix::KNUTH);
+    }
+    else if (algorithm == "ostromoukhov") {
+        auto ditherer = std::make_unique<OstromoukhovDithrer>();
+        ditherer->setSerpentine(dither_json.value("serpentine", true));
+        return ditherer;
+    }
+    else if (algorithm == "riemersma") {
+        return std::make_unique<RiemersmaDithrer>();
+    }
+    else if (algorithm == "bluenoise") {
+        int noise_size = dither_json.value("noise_size", 64);
+        return std::make_unique<BlueNoiseDithrer>(noise_size);
+    }
+    else if (algorithm == "yliluoma") {
+        return std::make_unique<YliluomaDithrer>();
+    }
+    else if (algorithm == "halftone") {
+        float cell_size = dither_json.value("cell_size", 8.0f);
+        bool cmyk = dither_json.value("cmyk", false);
+        return std::make_unique<HalftoneDithrer>(cell_size, cmyk ? HalftoneMode::CMYK : HalftoneMode::CHANNELS);
+    }
+    else if (algorithm == "noise") {
+        bool tpdf = dither_json.value("tpdf", false);
+        uint64_t seed = dither_json.value("seed", static_cast<uint64_t>(0));
+        return std::make_unique<NoiseDithrer>(tpdf ? NoiseType::TRIANGULAR : NoiseType::WHITE, seed);
+    }
     
     return std::make_unique<FloydDithrer>();
 }
 
-int main() {
+int main(int argc, char* argv[]) {
+    // Shared by every request; set once here because changing it restarts the workers
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if ((arg == "-j" || arg == "--threads") && i + 1 < argc) {
+            thread_pool::setThreadCount(std::stoi(argv[++i]));
+        } else {
+            std::cerr << "Usage: " << argv[0] << " [--threads COUNT]" << std::endl;
+            return 1;
+        }
+    }
+
     httplib::Server svr;
     
     // Enable CORS
@@ -203,7 +256,13 @@ int main() {
                 {"width", output_image.getWidth()},
                 {"height", output_image.getHeight()}
             };
-            
+
+            // ASCII art also comes back as text, rendered in memory
+            if (auto* ascii = dynamic_cast<AsciiDithrer*>(ditherer.get())) {
+                std::string text;
+                if (ascii->renderAsText(*input_image, text)) response["text"] = text;
+            }
+
             res.set_content(response.dump(), "application/json");
             
         } catch (const std::exception& e) {
@@ -220,12 +279,16 @@ int main() {
         json response = {
             {"status", "ok"},
             {"service", "DitherBoy Web API"},
-            {"version", "1.0.0"}
+            {"version", "1.0.0"},
+            {"threads", thread_pool::threadCount()},
+            {"simd", cpu_dispatch::isaName(cpu_dispatch::activeIsa())}
         };
         res.set_content(response.dump(), "application/json");
     });
     
     std::cout << "DitherBoy Web Server starting on http://localhost:8080" << std::endl;
+    std::cout << "Worker threads: " << thread_pool::threadCount() << std::endl;
+    std::cout << "SIMD kernels: " << cpu_dispatch::isaName(cpu_dispatch::activeIsa()) << std::endl;
     std::cout << "API endpoints:" << std::endl;
     std::cout << "  GET  /api/health - Health check" << std::endl;
     std::cout << "  POST /api/dither - Apply dithering" << std::endl;
@@ -17,8 +17,8 @@ const originalPlaceholder = document.getElementById('originalPlaceholder');
 let uploadedImageData = null;
 let ditheredImageData = null;
 
-const algorithms = ['floyd', 'atkinson', 'ordered', 'threshold', 'ascii'];
-const algorithmNames = ['Floyd-Steinberg', 'Atkinson', 'Ordered (Bayer)', 'Threshold', 'ASCII'];
+const algorithms = ['floyd', 'atkinson', 'ordered', 'threshold', 'ascii', 'dot', 'ostromoukhov', 'riemersma', 'bluenoise', 'yliluoma', 'halftone', 'noise'];
+const algorithmNames = ['Floyd-Steinberg', 'Atkinson', 'Ordered (Bayer)', 'Threshold', 'ASCII', 'Dot Diffusion', 'Ostromoukhov', 'Riemersma', 'Blue Noise', 'Yliluoma', 'Halftone', 'Noise'];
 const palettes = ['grayscale', 'gameboy', 'nes', 'cga'];
 const paletteNames = ['Grayscale', 'GameBoy', 'NES', 'CGA'];
 
@@ -66,6 +66,18 @@ function updateParameters() {
         parametersDiv.appendChild(label);
     }
     
+    if (algorithm === 'floyd' || algorithm === 'atkinson' || algorithm === 'ostromoukhov') {
+        const serpentineLabel = document.createElement('label');
+        const serpentineCheckbox = document.createElement('input');
+        serpentineCheckbox.type = 'checkbox';
+        serpentineCheckbox.id = 'serpentine';
+        // Ostromoukhov's weights are tuned for serpentine scanning
+        serpentineCheckbox.checked = algorithm === 'ostromoukhov';
+        serpentineLabel.appendChild(serpentineCheckbox);
+        serpentineLabel.appendChild(document.createTextNode(' Serpentine Scan'));
+        parametersDiv.appendChild(serpentineLabel);
+    }
+    
     if (algorithm === 'ordered') {
         const label = document.createElement('label');
         label.textContent = 'Bayer Size:';
@@ -74,7 +86,7 @@ function updateParameters() {
         input.id = 'bayerSize';
         input.value = 2;
         input.min = 1;
-        input.max = 4;
+        input.max = 8;
         input.className = 'slider';
         const valueSpan = document.createElement('span');
         valueSpan.textContent = '2';
@@ -88,6 +100,85 @@ function updateParameters() {
         parametersDiv.appendChild(label);
     }
     
+    if (algorithm === 'bluenoise') {
+        const label = document.createElement('label');
+        label.textContent = 'Mask Size:';
+        const select = document.createElement('select');
+        select.id = 'noiseSize';
+        [64, 128, 256].forEach((size) => {
+            const opt = document.createElement('option');
+            opt.value = size;
+            opt.textContent = size + 'x' + size;
+            select.appendChild(opt);
+        });
+        label.appendChild(select);
+        parametersDiv.appendChild(label);
+    }
+    
+    if (algorithm === 'halftone') {
+        const label = document.createElement('label');
+        label.textContent = 'Cell Size:';
+        const input = document.createElement('input');
+        input.type = 'range';
+        input.id = 'cellSize';
+        input.value = 8;
+        input.min = 2;
+        input.max = 24;
+        input.className = 'slider';
+        const valueSpan = document.createElement('span');
+        valueSpan.textContent = '8';
+        valueSpan.style.color = '#0078d7';
+        valueSpan.style.fontWeight = '600';
+        input.addEventListener('input', (e) => {
+            valueSpan.textContent = e.target.value;
+        });
+        label.appendChild(input);
+        label.appendChild(valueSpan);
+        parametersDiv.appendChild(label);
+        
+        const cmykLabel = document.createElement('label');
+        const cmykCheckbox = document.createElement('input');
+        cmykCheckbox.type = 'checkbox';
+        cmykCheckbox.id = 'cmyk';
+        cmykCheckbox.checked = false;
+        cmykLabel.appendChild(cmykCheckbox);
+        cmykLabel.appendChild(document.createTextNode(' CMYK Separation'));
+        parametersDiv.appendChild(cmykLabel);
+    }
+    
+    if (algorithm === 'dot') {
+        const optimizedLabel = document.createElement('label');
+        const optimizedCheckbox = document.createElement('input');
+        optimizedCheckbox.type = 'checkbox';
+        optimizedCheckbox.id = 'optimizedClasses';
+        optimizedCheckbox.checked = false;
+        optimizedLabel.appendChild(optimizedCheckbox);
+        optimizedLabel.appendChild(document.createTextNode(' Optimized Class Matrix'));
+        parametersDiv.appendChild(optimizedLabel);
+    }
+    
+    if (algorithm === 'noise') {
+        const tpdfLabel = document.createElement('label');
+        const tpdfCheckbox = document.createElement('input');
+        tpdfCheckbox.type = 'checkbox';
+        tpdfCheckbox.id = 'tpdf';
+        tpdfCheckbox.checked = false;
+        tpdfLabel.appendChild(tpdfCheckbox);
+        tpdfLabel.appendChild(document.createTextNode(' Triangular (TPDF)'));
+        parametersDiv.appendChild(tpdfLabel);
+        
+        const seedLabel = document.createElement('label');
+        seedLabel.style.marginLeft = '12px';
+        seedLabel.textContent = 'Seed:';
+        const seedInput = document.createElement('input');
+        seedInput.type = 'number';
+        seedInput.id = 'seed';
+        seedInput.value = 0;
+        seedInput.min = 0;
+        seedLabel.appendChild(seedInput);
+        parametersDiv.appendChild(seedLabel);
+    }
+    
     if (algorithm === 'threshold') {
         const label = document.createElement('label');
         label.textContent = 'Threshold:';
@@ -214,9 +305,26 @@ ditherBtn.addEventListener('click', async () => {
     if (palette === 'grayscale') {
         params.levels = parseInt(document.getElementById('grayscaleLevels').value) || 4;
     }
+    if (algorithm === 'floyd' || algorithm === 'atkinson' || algorithm === 'ostromoukhov') {
+        params.serpentine = document.getElementById('serpentine').checked;
+    }
     if (algorithm === 'ordered') {
         params.bayer_size = parseInt(document.getElementById('bayerSize').value) || 2;
     }
+    if (algorithm === 'bluenoise') {
+        params.noise_size = parseInt(document.getElementById('noiseSize').value) || 64;
+    }
+    if (algorithm === 'halftone') {
+        params.cell_size = parseFloat(document.getElementById('cellSize').value) || 8;
+        params.cmyk = document.getElementById('cmyk').checked;
+    }
+    if (algorithm === 'dot') {
+        params.optimized = document.getElementById('optimizedClasses').checked;
+    }
+    if (algorithm === 'noise') {
+        params.tpdf = document.getElementById('tpdf').checked;
+        params.seed = parseInt(document.getElementById('seed').value) || 0;
+    }
     if (algorithm === 'threshold') {
         params.threshold = parseFloat(document.getElementById('threshold').value) || 0.5;
     }
@@ -0,0 +1,190 @@
+//
+// Created by Dhruva Sharma on 18/2/25.
+//
+
+#include "headers/yliluoma_dithrer.h"
+#include "headers/gray_pipeline.h"
+#include "headers/thread_pool.h"
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace {
+
+constexpr int kBits = 5;
+constexpr int kSteps = (1 << kBits) - 1;
+constexpr int kKeys = 1 << (3 * kBits);
+// Cached palettes; past this the cache starts over rather than growing without bound
+constexpr size_t kMaxCachedPalettes = 16;
+
+float Luma(const Color& color) {
+  return color.r * 0.299f + color.g * 0.587f + color.b * 0.114f;
+}
+
+// Yliluoma's psychovisual distance: channel differences weighted by their share of luma,
+// plus the luma difference itself
+float Penalty(const Color& a, const Color& b) {
+  float dr = a.r - b.r, dg = a.g - b.g, db = a.b - b.b;
+  float dl = Luma(a) - Luma(b);
+  return (dr * dr * 0.299f + dg * dg * 0.587f + db * db * 0.114f) * 0.75f + dl * dl;
+}
+
+// Greedy plan: repeatedly add the entry (1, 2, 4, ... copies of it) that brings the running
+// mean closest to the target, then sort by luma so low thresholds take the dark entries.
+template <typename Index>
+void BuildPlan(const Color& target, const Pallete& pallete, Index* plan) {
+  int size = pallete.getSize();
+  int count = 0;
+  float sum[3] = {0.0f, 0.0f, 0.0f};
+  while (count < YliluomaDithrer::kPlanSize) {
+    int chosen = 0, chosenAmount = 1;
+    float leastPenalty = -1.0f;
+    int maxAmount = std::max(1, count);
+    for (int index = 0; index < size; ++index) {
+      const Color& color = pallete.getColor(index);
+      for (int amount = 1; amount <= maxAmount; amount *= 2) {
+        float total = static_cast<float>(count + amount);
+        Color mean((sum[0] + color.r * amount) / total, (sum[1] + color.g * amount) / total,
+                   (sum[2] + color.b * amount) / total);
+        float penalty = Penalty(target, mean);
+        if (leastPenalty < 0.0f || penalty < leastPenalty) {
+          leastPenalty = penalty;
+          chosen = index;
+          chosenAmount = amount;
+        }
+      }
+    }
+    const Color& color = pallete.getColor(chosen);
+    for (int i = 0; i < chosenAmount && count < YliluomaDithrer::kPlanSize; ++i) {
+      plan[count++] = static_cast<Index>(chosen);
+      sum[0] += color.r;
+      sum[1] += color.g;
+      sum[2] += color.b;
+    }
+  }
+  std::stable_sort(plan, plan + YliluomaDithrer::kPlanSize, [&](Index a, Index b) {
+    return Luma(pallete.getColor(a)) < Luma(pallete.getColor(b));
+  });
+}
+
+// Plans for one palette, filled on demand
+struct PlanTable {
+  std::mutex mutex;
+  std::vector<unsigned char> ready = std::vector<unsigned char>(kKeys, 0);
+  std::vector<uint16_t> plans = std::vector<uint16_t>(static_cast<size_t>(kKeys) * YliluomaDithrer::kPlanSize);
+};
+
+std::shared_ptr<PlanTable> SharedTable(const Pallete& pallete) {
+  static std::mutex mutex;
+  static std::map<std::vector<float>, std::shared_ptr<PlanTable>> tables;
+
+  std::vector<float> signature;
+  for (int i = 0; i < pallete.getSize(); ++i) {
+    const Color& color = pallete.getColor(i);
+    signature.insert(signature.end(), {color.r, color.g, color.b});
+  }
+  std::lock_guard<std::mutex> lock(mutex);
+  auto found = tables.find(signature);
+  if (found != tables.end()) return found->second;
+  if (tables.size() >= kMaxCachedPalettes) tables.clear();
+  auto table = std::make_shared<PlanTable>();
+  tables.emplace(std::move(signature), table);
+  return table;
+}
+
+int Quantize(float value) {
+  return static_cast<int>(std::max(0.0f, std::min(1.0f, value)) * kSteps + 0.5f);
+}
+
+}
+
+YliluomaDithrer::YliluomaDithrer() : matrix_(bayer_tables::view(3)) {}
+
+void YliluomaDithrer::applyDither(const Image& inputImage, Image& outputImage, const Pallete& pallete) {
+  int width = inputImage.getWidth();
+  int height = inputImage.getHeight();
+  int mask = matrix_.size - 1;
+  if (pallete.getSize() == 0) {
+    outputImage = inputImage;
+    return;
+  }
+
+  if (gray_pipeline::canUse(pallete)) {
+    // 256 gray levels are few enough to plan exactly for each image
+    std::vector<unsigned char> gray = gray_pipeline::decodeGray8(inputImage);
+    std::vector<unsigned char> plans(256 * kPlanSize);
+    bool used[256] = {};
+    for (unsigned char value : gray) used[value] = true;
+    std::vector<int> values;
+    for (int v = 0; v < 256; ++v) {
+      if (used[v]) values.push_back(v);
+    }
+    thread_pool::parallelFor(0, static_cast<int>(values.size()), 1, [&](int first, int last) {
+      for (int i = first; i < last; ++i) {
+        float level = values[i] / 255.0f;
+        BuildPlan(Color(level, level, level), pallete, plans.data() + values[i] * kPlanSize);
+      }
+    });
+    std::vector<unsigned char> indices(gray.size());
+    thread_pool::parallelFor(0, height, 0, [&](int first, int last) {
+      for (int y = first; y < last; ++y) {
+        const unsigned char* in = gray.data() + static_cast<size_t>(y) * width;
+        unsigned char* out = indices.data() + static_cast<size_t>(y) * width;
+        const float* thresholds = matrix_.thresholds + (y & mask) * matrix_.size;
+        for (int x = 0; x < width; ++x) {
+          out[x] = plans[in[x] * kPlanSize + static_cast<int>(thresholds[x & mask] * kPlanSize)];
+        }
+      }
+    });
+    gray_pipeline::emitIndices(indices, width, height, pallete, outputImage);
+    return;
+  }
+
+  // Quantize once, plan every missing color under the table lock, then only look up
+  std::vector<uint16_t> keys(static_cast<size_t>(width) * height);
+  thread_pool::parallelFor(0, height, 0, [&](int first, int last) {
+    for (int y = first; y < last; ++y) {
+      const Color* in = inputImage.getRow(y);
+      uint16_t* out = keys.data() + static_cast<size_t>(y) * width;
+      for (int x = 0; x < width; ++x) {
+        out[x] = static_cast<uint16_t>((Quantize(in[x].r) << (2 * kBits)) | (Quantize(in[x].g) << kBits) | Quantize(in[x].b));
+      }
+    }
+  });
+
+  std::shared_ptr<PlanTable> table = SharedTable(pallete);
+  {
+    std::lock_guard<std::mutex> lock(table->mutex);
+    std::vector<uint16_t> missing;
+    for (uint16_t key : keys) {
+      if (table->ready[key]) continue;
+      table->ready[key] = 1;
+      missing.push_back(key);
+    }
+    thread_pool::parallelFor(0, static_cast<int>(missing.size()), 0, [&](int first, int last) {
+      for (int i = first; i < last; ++i) {
+        uint16_t key = missing[i];
+        Color target(static_cast<float>(key >> (2 * kBits)) / kSteps,
+                     static_cast<float>((key >> kBits) & kSteps) / kSteps,
+                     static_cast<float>(key & kSteps) / kSteps);
+        BuildPlan(target, pallete, table->plans.data() + static_cast<size_t>(key) * kPlanSize);
+      }
+    });
+  }
+
+  outputImage = Image(width, height);
+  thread_pool::parallelFor(0, height, 0, [&](int first, int last) {
+    for (int y = first; y < last; ++y) {
+      const uint16_t* in = keys.data() + static_cast<size_t>(y) * width;
+      Color* out = outputImage.getRow(y);
+      const float* thresholds = matrix_.thresholds + (y & mask) * matrix_.size;
+      for (int x = 0; x < width; ++x) {
+        const uint16_t* plan = table->plans.data() + static_cast<size_t>(in[x]) * kPlanSize;
+        out[x] = pallete.getColor(plan[static_cast<int>(thresholds[x & mask] * kPlanSize)]);
+      }
+    }
+  });
+}